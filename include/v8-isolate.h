@@ -848,6 +848,26 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Returns the number of deoptimization reasons tracked by
+   * GetDeoptimizationStatistics.
+   */
+  size_t NumberOfDeoptimizationReasons();
+
+  /**
+   * Get statistics about the eager deoptimizations of optimized code in this
+   * isolate for one deoptimization reason: how often it occurred, in how many
+   * functions, and how often the feedback the failing check speculated on was
+   * widened because a function kept deoptimizing for it.
+   *
+   * \param deopt_statistics The DeoptimizationStatistics object to fill in.
+   * \param reason_index The index of the reason, which ranges from 0 to
+   *   NumberOfDeoptimizationReasons() - 1.
+   * \returns true on success.
+   */
+  bool GetDeoptimizationStatistics(DeoptimizationStatistics* deopt_statistics,
+                                   size_t reason_index);
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -5,7 +5,11 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
+#include "v8-memory-span.h"   // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
@@ -19,6 +23,16 @@ class String;
  */
 class V8_EXPORT JSON {
  public:
+  /**
+   * Receives the output of StringifyToUtf8 in one or more pieces. The data is
+   * only valid for the duration of the call.
+   */
+  class Utf8Sink {
+   public:
+    virtual ~Utf8Sink() = default;
+    virtual void Append(const char* data, size_t length) = 0;
+  };
+
   /**
    * Tries to parse the string |json_string| and returns it as value if
    * successful.
@@ -30,6 +44,21 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Local<Context> context, Local<String> json_string);
 
+  /**
+   * Tries to parse UTF-8 encoded JSON text, split into |utf8_chunks| as it was
+   * received (e.g. from the network), and returns it as value if successful.
+   * The chunks don't need to be concatenated first, and a multi-byte sequence
+   * may be split across chunks. This is not an incremental parser: all chunks
+   * of the text must be passed in a single call.
+   *
+   * \param context The context in which to parse and create the value.
+   * \param utf8_chunks The UTF-8 encoded text to parse, in order.
+   * \return The corresponding value if successfully parsed.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
+      Local<Context> context,
+      const MemorySpan<const MemorySpan<const char>>& utf8_chunks);
+
   /**
    * Tries to stringify the JSON-serializable object |json_object| and returns
    * it as string if successful.
@@ -40,6 +69,23 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Like Stringify, but writes the result UTF-8 encoded to |sink| instead of
+   * creating a string.
+   *
+   * \param context The context in which to stringify.
+   * \param json_object The JSON-serializable object to stringify.
+   * \param sink Receives the UTF-8 encoded result.
+   * \param gap The indentation, as for the space argument of JSON.stringify.
+   * \return Just(true) if successfully stringified. Just(false) if
+   *   |json_object| has no JSON representation (e.g. undefined or a function),
+   *   in which case nothing is written to |sink|. Nothing if an exception was
+   *   thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToUtf8(
+      Local<Context> context, Local<Value> json_object, Utf8Sink* sink,
+      Local<String> gap = Local<String>());
 };
 
 }  // namespace v8
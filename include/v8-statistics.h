@@ -258,6 +258,27 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Counts of the eager deoptimizations of optimized code for one
+ * deoptimization reason, see Isolate::GetDeoptimizationStatistics.
+ */
+class V8_EXPORT DeoptimizationStatistics {
+ public:
+  DeoptimizationStatistics();
+  const char* reason() { return reason_; }
+  size_t deopt_count() { return deopt_count_; }
+  size_t function_count() { return function_count_; }
+  size_t despeculation_count() { return despeculation_count_; }
+
+ private:
+  const char* reason_;
+  size_t deopt_count_;
+  size_t function_count_;
+  size_t despeculation_count_;
+
+  friend class Isolate;
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_STATISTICS_H_
@@ -48,6 +48,7 @@
 #include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/date/date.h"
 #include "src/debug/debug.h"
+#include "src/deoptimizer/deoptimization-stats.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/embedder-state.h"
 #include "src/execution/execution.h"
@@ -126,6 +127,7 @@
 #include "src/snapshot/snapshot.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/utils/detachable-vector.h"
@@ -3428,6 +3430,135 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+namespace {
+
+// Returns the length of the multi-byte sequence at the end of |data| that may
+// be continued by the next chunk, or 0 if |data| ends on a sequence boundary.
+// This is at most 3 bytes, as UTF-8 sequences are at most 4 bytes long.
+size_t IncompleteUtf8SuffixLength(const uint8_t* data, size_t size) {
+  for (size_t i = 1; i <= std::min<size_t>(3, size); i++) {
+    uint8_t c = data[size - i];
+    if (c <= unibrow::Utf8::kMaxOneByteChar) return 0;
+    if (c < 0xC0) continue;  // Continuation byte.
+    size_t sequence_length = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : 2;
+    return i < sequence_length ? i : 0;
+  }
+  return 0;
+}
+
+// Calls |callback| on consecutive segments of UTF-8 |chunks| that each end on
+// a sequence boundary, so that decoding the segments one by one gives the
+// same result as decoding the concatenated chunks. A sequence that straddles
+// a chunk boundary is carried over in a small buffer together with the
+// continuation bytes that complete it; chunks are never joined.
+template <typename Callback>
+void ForEachUtf8Segment(const MemorySpan<const MemorySpan<const char>>& chunks,
+                        Callback callback) {
+  static constexpr size_t kMaxSequenceLength = 4;
+  uint8_t carry[kMaxSequenceLength];
+  size_t carry_length = 0;
+  for (const MemorySpan<const char>& chunk : chunks) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(chunk.data());
+    size_t size = chunk.size();
+    size_t start = 0;
+    if (carry_length > 0) {
+      while (start < size && carry_length < kMaxSequenceLength &&
+             (data[start] & 0xC0) == 0x80) {
+        carry[carry_length++] = data[start++];
+      }
+      // The carried sequence may be continued by the chunk after this one.
+      if (start == size && carry_length < kMaxSequenceLength) continue;
+      callback(base::Vector<const uint8_t>(carry, carry_length));
+      carry_length = 0;
+    }
+    size_t end = size - IncompleteUtf8SuffixLength(data + start, size - start);
+    if (end > start) {
+      callback(base::Vector<const uint8_t>(data + start, end - start));
+    }
+    carry_length = size - end;
+    std::copy_n(data + end, carry_length, carry);
+  }
+  if (carry_length > 0) {
+    callback(base::Vector<const uint8_t>(carry, carry_length));
+  }
+}
+
+template <typename Char>
+void DecodeUtf8Chunks(const MemorySpan<const MemorySpan<const char>>& chunks,
+                      Char* out) {
+  ForEachUtf8Segment(chunks, [&](base::Vector<const uint8_t> segment) {
+    i::Utf8Decoder decoder(segment);
+    decoder.Decode(out, segment);
+    out += decoder.utf16_length();
+  });
+}
+
+// Creates a single flat string from UTF-8 |chunks|. Each chunk is decoded in
+// place, see ForEachUtf8Segment.
+i::MaybeHandle<i::String> NewStringFromUtf8Chunks(
+    i::Isolate* isolate,
+    const MemorySpan<const MemorySpan<const char>>& chunks) {
+  size_t size = 0;
+  for (const MemorySpan<const char>& chunk : chunks) {
+    if (chunk.size() > static_cast<size_t>(i::String::kMaxLength) - size) {
+      return isolate->Throw<i::String>(
+          isolate->factory()->NewInvalidStringLengthError());
+    }
+    size += chunk.size();
+  }
+  if (size == 0) return isolate->factory()->empty_string();
+  if (chunks.size() == 1) {
+    return isolate->factory()->NewStringFromUtf8(
+        base::Vector<const char>(chunks[0].data(), size));
+  }
+
+  int length = 0;
+  bool is_one_byte = true;
+  ForEachUtf8Segment(chunks, [&](base::Vector<const uint8_t> segment) {
+    i::Utf8Decoder decoder(segment);
+    length += decoder.utf16_length();
+    is_one_byte = is_one_byte && decoder.is_one_byte();
+  });
+
+  if (is_one_byte) {
+    i::Handle<i::SeqOneByteString> result;
+    if (!isolate->factory()->NewRawOneByteString(length).ToHandle(&result)) {
+      return {};
+    }
+    i::DisallowGarbageCollection no_gc;
+    DecodeUtf8Chunks(chunks, result->GetChars(no_gc));
+    return result;
+  }
+  i::Handle<i::SeqTwoByteString> result;
+  if (!isolate->factory()->NewRawTwoByteString(length).ToHandle(&result)) {
+    return {};
+  }
+  i::DisallowGarbageCollection no_gc;
+  DecodeUtf8Chunks(chunks, result->GetChars(no_gc));
+  return result;
+}
+
+}  // namespace
+
+MaybeLocal<Value> JSON::Parse(
+    Local<Context> context,
+    const MemorySpan<const MemorySpan<const char>>& utf8_chunks) {
+  PREPARE_FOR_EXECUTION(context, JSON, Parse);
+  i::Handle<i::String> source;
+  has_exception =
+      !NewStringFromUtf8Chunks(i_isolate, utf8_chunks).ToHandle(&source);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  i::Handle<i::Object> undefined = i_isolate->factory()->undefined_value();
+  auto maybe =
+      source->IsOneByteRepresentation()
+          ? i::JsonParser<uint8_t>::Parse(i_isolate, source, undefined)
+          : i::JsonParser<uint16_t>::Parse(i_isolate, source, undefined);
+  Local<Value> result;
+  has_exception = !ToLocal<Value>(maybe, &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3448,6 +3579,22 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::StringifyToUtf8(Local<Context> context,
+                                  Local<Value> json_object, Utf8Sink* sink,
+                                  Local<String> gap) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(i_isolate, context, JSON, Stringify, i::HandleScope);
+  auto object = Utils::OpenHandle(*json_object);
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? i_isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  Maybe<bool> result =
+      i::JsonStringifyToUtf8(i_isolate, object, gap_string, sink);
+  has_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -6505,6 +6652,12 @@ HeapCodeStatistics::HeapCodeStatistics()
       external_script_source_size_(0),
       cpu_profiler_metadata_size_(0) {}
 
+DeoptimizationStatistics::DeoptimizationStatistics()
+    : reason_(nullptr),
+      deopt_count_(0),
+      function_count_(0),
+      despeculation_count_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -10043,6 +10196,27 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+size_t Isolate::NumberOfDeoptimizationReasons() {
+  return i::kDeoptimizeReasonCount;
+}
+
+bool Isolate::GetDeoptimizationStatistics(
+    DeoptimizationStatistics* deopt_statistics, size_t reason_index) {
+  if (!deopt_statistics) return false;
+  if (reason_index >= NumberOfDeoptimizationReasons()) return false;
+
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i::DeoptimizationStats* stats = i_isolate->deoptimization_stats();
+  i::DeoptimizeReason reason = static_cast<i::DeoptimizeReason>(reason_index);
+
+  deopt_statistics->reason_ = i::DeoptimizeReasonToString(reason);
+  deopt_statistics->deopt_count_ = stats->count(reason);
+  deopt_statistics->function_count_ = stats->function_count(reason);
+  deopt_statistics->despeculation_count_ = stats->despeculation_count(reason);
+
+  return true;
+}
+
 bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
                             MeasureMemoryExecution execution) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
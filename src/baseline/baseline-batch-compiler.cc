@@ -281,6 +281,20 @@ void BaselineBatchCompiler::EnqueueSFI(Tagged<SharedFunctionInfo> shared) {
   }
 }
 
+void BaselineBatchCompiler::CompilePendingBatchConcurrent() {
+  if (!v8_flags.concurrent_sparkplug || !is_enabled()) return;
+  if (last_index_ == 0) return;
+  if (v8_flags.trace_baseline_batch_compilation) {
+    CodeTracer::Scope trace_scope(isolate_->GetCodeTracer());
+    PrintF(trace_scope.file(),
+           "[Baseline batch compilation] Compiling pending batch of %d "
+           "functions\n",
+           last_index_);
+  }
+  concurrent_compiler_->CompileBatch(compilation_queue_, last_index_);
+  ClearBatch();
+}
+
 void BaselineBatchCompiler::Enqueue(Handle<SharedFunctionInfo> shared) {
   EnsureQueueCapacity();
   compilation_queue_->set(last_index_++, MakeWeak(*shared));
@@ -27,6 +27,10 @@ class BaselineBatchCompiler {
   void EnqueueFunction(Handle<JSFunction> function);
   void EnqueueSFI(Tagged<SharedFunctionInfo> shared);
 
+  // Starts concurrent compilation of the functions enqueued so far, even if
+  // the batch hasn't reached the size threshold yet.
+  void CompilePendingBatchConcurrent();
+
   void set_enabled(bool enabled) { enabled_ = enabled; }
   bool is_enabled() { return enabled_; }
 
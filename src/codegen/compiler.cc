@@ -14,6 +14,7 @@
 #include "src/base/logging.h"
 #include "src/base/optional.h"
 #include "src/base/platform/time.h"
+#include "src/baseline/baseline-batch-compiler.h"
 #include "src/baseline/baseline.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
@@ -1527,6 +1528,28 @@ void CompileAllWithBaseline(Isolate* isolate,
   }
 }
 
+// Compiles the functions of a freshly compiled script with Sparkplug for
+// --sparkplug-on-load. With concurrent Sparkplug, the functions are handed to
+// the batch compiler so that the main thread only has to install the code.
+void CompileAllWithBaselineOnLoad(
+    Isolate* isolate, const FinalizeUnoptimizedCompilationDataList&
+                          finalize_unoptimized_compilation_data_list) {
+  baseline::BaselineBatchCompiler* batch_compiler =
+      isolate->baseline_batch_compiler();
+  if (!v8_flags.concurrent_sparkplug || !batch_compiler->is_enabled()) {
+    CompileAllWithBaseline(isolate, finalize_unoptimized_compilation_data_list);
+    return;
+  }
+  for (const auto& finalize_data : finalize_unoptimized_compilation_data_list) {
+    Handle<SharedFunctionInfo> shared_info = finalize_data.function_handle();
+    IsCompiledScope is_compiled_scope(*shared_info, isolate);
+    if (!is_compiled_scope.is_compiled()) continue;
+    if (!CanCompileWithBaseline(isolate, *shared_info)) continue;
+    batch_compiler->EnqueueSFI(*shared_info);
+  }
+  batch_compiler->CompilePendingBatchConcurrent();
+}
+
 // Create shared function info for top level and shared function infos array for
 // inner functions.
 template <typename IsolateT>
@@ -1612,6 +1635,9 @@ MaybeHandle<SharedFunctionInfo> CompileToplevel(
 
   if (v8_flags.always_sparkplug) {
     CompileAllWithBaseline(isolate, finalize_unoptimized_compilation_data_list);
+  } else if (v8_flags.sparkplug_on_load) {
+    CompileAllWithBaselineOnLoad(isolate,
+                                 finalize_unoptimized_compilation_data_list);
   }
 
   return shared_info;
@@ -2343,6 +2369,11 @@ MaybeHandle<SharedFunctionInfo> BackgroundCompileTask::FinalizeScript(
   FinalizeUnoptimizedScriptCompilation(isolate, script, flags_, &compile_state_,
                                        finalize_unoptimized_compilation_data_);
 
+  if (v8_flags.sparkplug_on_load) {
+    CompileAllWithBaselineOnLoad(isolate,
+                                 finalize_unoptimized_compilation_data_);
+  }
+
   return handle(*result, isolate);
 }
 
@@ -2524,6 +2555,7 @@ bool Compiler::CollectSourcePositions(Isolate* isolate,
   // Prevent parallel tasks from being spawned by this job.
   flags.set_post_parallel_compile_tasks_for_eager_toplevel(false);
   flags.set_post_parallel_compile_tasks_for_lazy(false);
+  flags.set_post_parallel_compile_tasks_for_likely_called(false);
 
   UnoptimizedCompileState compile_state;
   ReusableUnoptimizedCompileState reusable_state(isolate);
@@ -2577,6 +2609,21 @@ bool Compiler::CollectSourcePositions(Isolate* isolate,
   return true;
 }
 
+namespace {
+
+void MaybeRecordStartupCompile(Isolate* isolate,
+                               Tagged<SharedFunctionInfo> shared_info) {
+  if (V8_LIKELY(!v8_flags.code_cache_startup_profile)) return;
+  if (v8_flags.code_cache_startup_profile_ms > 0 &&
+      isolate->time_millis_since_init() >
+          v8_flags.code_cache_startup_profile_ms) {
+    return;
+  }
+  shared_info->set_compiled_during_startup(true);
+}
+
+}  // namespace
+
 // static
 bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
                        ClearExceptionFlag flag,
@@ -2618,6 +2665,7 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
     }
     *is_compiled_scope = shared_info->is_compiled_scope(isolate);
     DCHECK(is_compiled_scope->is_compiled());
+    MaybeRecordStartupCompile(isolate, *shared_info);
     return true;
   }
 
@@ -2668,6 +2716,8 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
     script->set_compiled_lazy_function_positions(*list);
   }
 
+  MaybeRecordStartupCompile(isolate, *shared_info);
+
   DCHECK(!isolate->has_exception());
   DCHECK(is_compiled_scope->is_compiled());
   return true;
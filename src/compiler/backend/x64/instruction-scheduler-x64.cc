@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/codegen/cpu-features.h"
 #include "src/compiler/backend/instruction-scheduler.h"
 
 namespace v8 {
@@ -418,7 +419,81 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
+namespace {
+
+// Latencies for the small in-order-ish Atom cores (Silvermont/Goldmont), where
+// multiplications, divisions and conversions are considerably slower than on
+// the big cores. Values are approximated from published instruction tables.
+int GetAtomInstructionLatency(const Instruction* instr) {
+  switch (instr->arch_opcode()) {
+    case kX64Imul32:
+      return 3;
+    case kX64Imul:
+    case kX64ImulHigh32:
+    case kX64UmulHigh32:
+    case kX64ImulHigh64:
+    case kX64UmulHigh64:
+    case kSSEFloat32Mul:
+    case kSSEFloat64Mul:
+    case kSSEFloat32ToInt32:
+    case kSSEFloat32ToUint32:
+    case kSSEFloat64ToInt32:
+    case kSSEFloat64ToUint32:
+      return 5;
+    case kX64Float32Abs:
+    case kX64Float32Neg:
+    case kX64Float64Abs:
+    case kX64Float64Neg:
+    case kSSEFloat32Cmp:
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat64Cmp:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kSSEFloat64Max:
+    case kSSEFloat64Min:
+      return 3;
+    case kSSEFloat32ToFloat64:
+    case kSSEFloat64ToFloat32:
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+      return 4;
+    case kX64Idiv:
+      return 70;
+    case kX64Idiv32:
+      return 38;
+    case kX64Udiv:
+      return 60;
+    case kX64Udiv32:
+      return 30;
+    case kSSEFloat32Div:
+    case kSSEFloat32Sqrt:
+      return 19;
+    case kSSEFloat64Div:
+    case kSSEFloat64Sqrt:
+      return 34;
+    case kSSEFloat32ToInt64:
+    case kSSEFloat64ToInt64:
+    case kSSEFloat32ToUint64:
+    case kSSEFloat64ToUint64:
+      return 12;
+    case kSSEFloat64Mod:
+      return 80;
+    case kArchTruncateDoubleToI:
+      return 8;
+    default:
+      return 1;
+  }
+}
+
+}  // namespace
+
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+  // The latency model is picked from the detected micro-architecture (which
+  // can be overridden with --mcpu).
+  if (CpuFeatures::IsSupported(INTEL_ATOM)) {
+    return GetAtomInstructionLatency(instr);
+  }
   // Basic latency modeling for x64 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
@@ -4,11 +4,13 @@
 
 #include "src/compiler/js-inlining-heuristic.h"
 
+#include "src/base/small-vector.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/js-heap-broker.h"
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/simplified-operator.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 
 namespace v8 {
 namespace internal {
@@ -82,8 +84,134 @@ bool CanConsiderForInlining(JSHeapBroker* broker, JSFunctionRef function) {
   return result;
 }
 
+// Weights of the inlining cost model, in units of bytecode size. A use of a
+// constant argument usually lets the consuming bytecode be constant-folded,
+// while a property access on an argument with a known map saves the map check
+// and, for objects allocated in the caller, may let escape analysis remove
+// the allocation altogether.
+constexpr int kConstantArgumentUseBenefit = 3;
+constexpr int kKnownMapPropertyAccessBenefit = 6;
+
+enum class ArgumentKind { kUnknown, kConstant, kFreshAllocation };
+
+ArgumentKind ClassifyArgument(Node* node) {
+  if (NodeProperties::IsConstant(node)) return ArgumentKind::kConstant;
+  switch (node->opcode()) {
+    case IrOpcode::kJSCreate:
+    case IrOpcode::kJSCreateArray:
+    case IrOpcode::kJSCreateClosure:
+    case IrOpcode::kJSCreateEmptyLiteralArray:
+    case IrOpcode::kJSCreateEmptyLiteralObject:
+    case IrOpcode::kJSCreateLiteralArray:
+    case IrOpcode::kJSCreateLiteralObject:
+    case IrOpcode::kJSCreateObject:
+      return ArgumentKind::kFreshAllocation;
+    default:
+      return ArgumentKind::kUnknown;
+  }
+}
+
+// Returns true if the first operand of {bytecode} is the register holding the
+// object whose property is accessed.
+bool IsPropertyAccess(interpreter::Bytecode bytecode) {
+  switch (bytecode) {
+    case interpreter::Bytecode::kGetNamedProperty:
+    case interpreter::Bytecode::kGetKeyedProperty:
+    case interpreter::Bytecode::kSetNamedProperty:
+    case interpreter::Bytecode::kSetKeyedProperty:
+    case interpreter::Bytecode::kDefineNamedOwnProperty:
+    case interpreter::Bytecode::kDefineKeyedOwnProperty:
+      return true;
+    default:
+      return false;
+  }
+}
+
 }  // namespace
 
+int JSInliningHeuristic::EstimateInliningBenefit(
+    Node* node, BytecodeArrayRef bytecode) const {
+  if (!v8_flags.turbo_inlining_cost_model) return 0;
+  // The scan is linear in the bytecode size, so don't bother for functions
+  // that the JSInliner is going to reject anyway.
+  if (bytecode.length() > v8_flags.max_inlined_bytecode_size) return 0;
+
+  // Classify the values passed for each of the callee's parameters (including
+  // the receiver, which is parameter 0).
+  int const parameter_count = bytecode.parameter_count();
+  base::SmallVector<ArgumentKind, 8> parameters(parameter_count,
+                                                ArgumentKind::kUnknown);
+  int argument_count;
+  if (node->opcode() == IrOpcode::kJSCall) {
+    JSCallNode n(node);
+    if (parameter_count > 0) parameters[0] = ClassifyArgument(n.receiver());
+    argument_count = n.ArgumentCount();
+  } else {
+    // The receiver of a construct call is allocated by the callee.
+    argument_count = JSConstructNode(node).ArgumentCount();
+  }
+  bool has_known_argument =
+      parameter_count > 0 && parameters[0] != ArgumentKind::kUnknown;
+  for (int i = 0; i < argument_count && i + 1 < parameter_count; ++i) {
+    parameters[i + 1] = ClassifyArgument(
+        node->InputAt(JSCallOrConstructNode::ArgumentIndex(i)));
+    has_known_argument |= parameters[i + 1] != ArgumentKind::kUnknown;
+  }
+  if (!has_known_argument) return 0;
+
+  int benefit = 0;
+  for (interpreter::BytecodeArrayIterator it(bytecode.object()); !it.done();
+       it.Advance()) {
+    interpreter::Bytecode const current = it.current_bytecode();
+    int const operand_count = interpreter::Bytecodes::NumberOfOperands(current);
+    for (int i = 0; i < operand_count; ++i) {
+      if (interpreter::Bytecodes::GetOperandType(current, i) !=
+          interpreter::OperandType::kReg) {
+        continue;
+      }
+      interpreter::Register reg = it.GetRegisterOperand(i);
+      if (!reg.is_parameter()) continue;
+      int const index = reg.ToParameterIndex();
+      if (index >= parameter_count) continue;
+      ArgumentKind const kind = parameters[index];
+      if (kind == ArgumentKind::kUnknown) continue;
+      if (kind == ArgumentKind::kConstant) {
+        benefit += kConstantArgumentUseBenefit;
+      }
+      if (i == 0 && IsPropertyAccess(current)) {
+        benefit += kKnownMapPropertyAccessBenefit;
+      }
+    }
+  }
+
+  // Never let the estimate discount more than the configured share of the
+  // function, so that the size budgets keep bounding code growth.
+  int const max_benefit =
+      bytecode.length() * v8_flags.turbo_inlining_max_benefit_percent / 100;
+  return std::min(benefit, max_benefit);
+}
+
+void JSInliningHeuristic::TraceInliningDecision(Candidate const& candidate,
+                                                int index,
+                                                const char* decision,
+                                                int achieved_size) const {
+  SharedFunctionInfoRef shared =
+      candidate.functions[index].has_value()
+          ? candidate.functions[index]->shared(broker())
+          : candidate.shared_info.value();
+  int const bytecode_size = candidate.bytecode[index]->length();
+  int const benefit = candidate.estimated_benefit[index];
+  StdoutStream os;
+  os << "Inlining decision at call site #" << candidate.node->id() << ":"
+     << candidate.node->op()->mnemonic() << " for " << shared << ": "
+     << decision << " (bytecode size: " << bytecode_size
+     << ", estimated benefit: " << benefit
+     << ", predicted size: " << bytecode_size - benefit;
+  if (achieved_size >= 0) os << ", achieved size: " << achieved_size << " nodes";
+  os << ", total inlined: " << total_inlined_bytecode_size_ << ")"
+     << std::endl;
+}
+
 JSInliningHeuristic::Candidate JSInliningHeuristic::CollectFunctions(
     Node* node, int functions_size) {
   DCHECK_NE(0, functions_size);
@@ -231,8 +359,12 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
           candidate.total_size += inlined_bytecode_size;
         }
       }
-      candidate_is_small = candidate_is_small &&
-                           IsSmall(bytecode.length() + inlined_bytecode_size);
+      int const benefit = EstimateInliningBenefit(node, bytecode);
+      candidate.estimated_benefit[i] = benefit;
+      candidate.total_benefit += benefit;
+      candidate_is_small =
+          candidate_is_small &&
+          IsSmall(bytecode.length() + inlined_bytecode_size - benefit);
     }
   }
   if (!can_inline_candidate) return NoChange();
@@ -295,7 +427,8 @@ void JSInliningHeuristic::Finalize() {
     // Make sure we have some extra budget left, so that any small functions
     // exposed by this function would be given a chance to inline.
     double size_of_candidate =
-        candidate.total_size * v8_flags.reserve_inline_budget_scale_factor;
+        candidate.predicted_size() *
+        v8_flags.reserve_inline_budget_scale_factor;
     int total_size =
         total_inlined_bytecode_size_ + static_cast<int>(size_of_candidate);
     if (total_size > max_inlined_bytecode_size_cumulative_) {
@@ -303,6 +436,12 @@ void JSInliningHeuristic::Finalize() {
         info_->shared_info()->set_cached_tiering_decision(
             CachedTieringDecision::kNormal);
       }
+      if (v8_flags.trace_turbo_inlining_cost_model) {
+        for (int i = 0; i < candidate.num_functions; ++i) {
+          if (!candidate.can_inline_function[i]) continue;
+          TraceInliningDecision(candidate, i, "over budget", -1);
+        }
+      }
       // Try if any smaller functions are available to inline.
       continue;
     }
@@ -711,10 +850,16 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
   DCHECK_NE(node->opcode(), IrOpcode::kJSWasmCall);
 #endif  // V8_ENABLE_WEBASSEMBLY
   if (num_calls == 1) {
+    size_t const node_count_before = graph()->NodeCount();
     Reduction const reduction = inliner_.ReduceJSCall(node);
     if (reduction.Changed()) {
       total_inlined_bytecode_size_ += candidate.bytecode[0].value().length();
     }
+    if (v8_flags.trace_turbo_inlining_cost_model) {
+      TraceInliningDecision(
+          candidate, 0, reduction.Changed() ? "inlined" : "rejected by inliner",
+          static_cast<int>(graph()->NodeCount() - node_count_before));
+    }
     return reduction;
   }
 
@@ -778,6 +923,7 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
         (small_function || total_inlined_bytecode_size_ <
                                max_inlined_bytecode_size_cumulative_)) {
       Node* call = calls[i];
+      size_t const node_count_before = graph()->NodeCount();
       Reduction const reduction = inliner_.ReduceJSCall(call);
       if (reduction.Changed()) {
         total_inlined_bytecode_size_ += candidate.bytecode[i]->length();
@@ -785,6 +931,12 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
         // make sure we do not resurrect the node.
         call->Kill();
       }
+      if (v8_flags.trace_turbo_inlining_cost_model) {
+        TraceInliningDecision(
+            candidate, i,
+            reduction.Changed() ? "inlined" : "rejected by inliner",
+            static_cast<int>(graph()->NodeCount() - node_count_before));
+      }
     }
   }
 
@@ -807,6 +959,10 @@ bool JSInliningHeuristic::CandidateCompare::operator()(
     return true;
   } else if (left.frequency.value() < right.frequency.value()) {
     return false;
+  } else if (left.total_benefit != right.total_benefit) {
+    // Among equally hot call sites, prefer the ones that the cost model
+    // expects to benefit most from being specialized.
+    return left.total_benefit > right.total_benefit;
   } else {
     return left.node->id() > right.node->id();
   }
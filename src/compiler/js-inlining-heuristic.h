@@ -78,6 +78,13 @@ class JSInliningHeuristic final : public AdvancedReducer {
     Node* node = nullptr;     // The call site at which to inline.
     CallFrequency frequency;  // Relative frequency of this call site.
     int total_size = 0;
+    // Bytecode size the cost model expects to be folded away once each
+    // function is specialized to the arguments at this call site.
+    int estimated_benefit[kMaxCallPolymorphism] = {};
+    int total_benefit = 0;
+
+    // The size against which the inlining budget is charged.
+    int predicted_size() const { return total_size - total_benefit; }
   };
 
   // Comparator for candidates.
@@ -104,6 +111,12 @@ class JSInliningHeuristic final : public AdvancedReducer {
   Node* DuplicateStateValuesAndRename(Node* state_values, Node* from, Node* to,
                                       StateCloneMode mode);
   Candidate CollectFunctions(Node* node, int functions_size);
+  // Estimates how much of {bytecode} becomes dead or cheaper when it is
+  // inlined at the call site {node}, e.g. due to constant arguments or
+  // arguments whose maps are known.
+  int EstimateInliningBenefit(Node* node, BytecodeArrayRef bytecode) const;
+  void TraceInliningDecision(Candidate const& candidate, int index,
+                             const char* decision, int achieved_size) const;
 
   CommonOperatorBuilder* common() const;
   Graph* graph() const;
@@ -10,6 +10,7 @@
 #include <sstream>
 
 #include "src/base/optional.h"
+#include "src/base/platform/elapsed-timer.h"
 #include "src/builtins/builtins.h"
 #include "src/builtins/profile-data-reader.h"
 #include "src/codegen/assembler-inl.h"
@@ -372,6 +373,33 @@ class PipelineData {
   bool verify_graph() const { return verify_graph_; }
   void set_verify_graph(bool value) { verify_graph_ = value; }
 
+  // The compile budget bounds the time and zone memory of a single job; once
+  // it is exhausted, optional optimization phases are skipped (see
+  // --turbo-compile-time-budget and --turbo-compile-memory-budget).
+  void StartCompileBudget() { compile_budget_timer_.Start(); }
+  bool CompileBudgetExceeded() const {
+    if (v8_flags.turbo_compile_time_budget > 0 &&
+        compile_budget_timer_.IsStarted() &&
+        compile_budget_timer_.Elapsed().InMilliseconds() >=
+            v8_flags.turbo_compile_time_budget) {
+      return true;
+    }
+    if (v8_flags.turbo_compile_memory_budget > 0 &&
+        zone_stats_->GetCurrentAllocatedBytes() >=
+            static_cast<size_t>(v8_flags.turbo_compile_memory_budget) * MB) {
+      return true;
+    }
+    return false;
+  }
+  base::TimeDelta compile_budget_elapsed() const {
+    return compile_budget_timer_.IsStarted() ? compile_budget_timer_.Elapsed()
+                                             : base::TimeDelta();
+  }
+  int compile_budget_skipped_phases() const {
+    return compile_budget_skipped_phases_;
+  }
+  void RecordCompileBudgetSkippedPhase() { compile_budget_skipped_phases_++; }
+
   MaybeHandle<Code> code() { return code_; }
   void set_code(MaybeHandle<Code> code) {
     DCHECK(code_.is_null());
@@ -667,6 +695,8 @@ class PipelineData {
   ZoneStats* const zone_stats_;
   TurbofanPipelineStatistics* pipeline_statistics_ = nullptr;
   bool verify_graph_ = false;
+  base::ElapsedTimer compile_budget_timer_;
+  int compile_budget_skipped_phases_ = 0;
   int start_source_position_ = kNoSourcePosition;
   base::Optional<OsrHelper> osr_helper_;
   MaybeHandle<Code> code_;
@@ -783,6 +813,10 @@ class PipelineImpl final {
 
   void VerifyGeneratedCodeIsIdempotent();
   void RunPrintAndVerify(const char* phase, bool untyped = false);
+  // Returns false if the optional phase {phase_name} should be skipped
+  // because the compile budget of this job is exhausted.
+  bool WithinCompileBudget(const char* phase_name);
+  void TraceCompileBudget();
   bool SelectInstructionsAndAssemble(CallDescriptor* call_descriptor);
   MaybeHandle<Code> GenerateCode(CallDescriptor* call_descriptor);
   void AllocateRegisters(const RegisterConfiguration* config,
@@ -1286,6 +1320,7 @@ PipelineCompilationJob::Status PipelineCompilationJob::ExecuteJobImpl(
   PipelineJobScope scope(&data_, stats);
   LocalIsolateScope local_isolate_scope(data_.broker(), data_.info(),
                                         local_isolate);
+  data_.StartCompileBudget();
 
   if (!pipeline_.CreateGraph()) {
     return AbortOptimization(BailoutReason::kGraphBuildingFailed);
@@ -1295,6 +1330,7 @@ PipelineCompilationJob::Status PipelineCompilationJob::ExecuteJobImpl(
   if (!pipeline_.OptimizeGraph(linkage_)) return FAILED;
 
   pipeline_.AssembleCode(linkage_);
+  pipeline_.TraceCompileBudget();
 
   return SUCCEEDED;
 }
@@ -2985,6 +3021,29 @@ void PipelineImpl::RunPrintAndVerify(const char* phase, bool untyped) {
   }
 }
 
+bool PipelineImpl::WithinCompileBudget(const char* phase_name) {
+  if (!data_->CompileBudgetExceeded()) return true;
+  data_->RecordCompileBudgetSkippedPhase();
+  if (v8_flags.trace_turbo_compile_budget) {
+    StdoutStream{} << "[compile budget] " << info()->GetDebugName().get()
+                   << ": skipping " << phase_name << std::endl;
+  }
+  return false;
+}
+
+void PipelineImpl::TraceCompileBudget() {
+  if (!v8_flags.trace_turbo_compile_budget) return;
+  if (data_->compile_budget_skipped_phases() == 0) return;
+  StdoutStream{} << "[compile budget] " << info()->GetDebugName().get()
+                 << ": exceeded, skipped "
+                 << data_->compile_budget_skipped_phases()
+                 << " optional phase(s), "
+                 << data_->compile_budget_elapsed().InMillisecondsF()
+                 << " ms, "
+                 << data_->zone_stats()->GetMaxAllocatedBytes() / KB
+                 << " KB peak zone memory" << std::endl;
+}
+
 void PipelineImpl::InitializeHeapBroker() {
   PipelineData* data = data_;
 
@@ -3075,7 +3134,8 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     Run<TypedLoweringPhase>();
     RunPrintAndVerify(TypedLoweringPhase::phase_name());
 
-    if (data->info()->loop_peeling()) {
+    if (data->info()->loop_peeling() &&
+        WithinCompileBudget(LoopPeelingPhase::phase_name())) {
       Run<LoopPeelingPhase>();
       RunPrintAndVerify(LoopPeelingPhase::phase_name(), true);
     } else {
@@ -3083,13 +3143,15 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
       RunPrintAndVerify(LoopExitEliminationPhase::phase_name(), true);
     }
 
-    if (v8_flags.turbo_load_elimination) {
+    if (v8_flags.turbo_load_elimination &&
+        WithinCompileBudget(LoadEliminationPhase::phase_name())) {
       Run<LoadEliminationPhase>();
       RunPrintAndVerify(LoadEliminationPhase::phase_name());
     }
     data->DeleteTyper();
 
-    if (v8_flags.turbo_escape) {
+    if (v8_flags.turbo_escape &&
+        WithinCompileBudget(EscapeAnalysisPhase::phase_name())) {
       Run<EscapeAnalysisPhase>();
       RunPrintAndVerify(EscapeAnalysisPhase::phase_name());
     }
@@ -3235,21 +3297,27 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     // has to be triggered before emitting the loop header. This could be fixed
     // by changing LoopUnrolling start unrolling after the 1st header has been
     // emitted, but this would also require updating CloneSubgraph.
-    if (v8_flags.turboshaft_loop_peeling) {
+    if (v8_flags.turboshaft_loop_peeling &&
+        WithinCompileBudget(turboshaft::LoopPeelingPhase::phase_name())) {
       Run<turboshaft::LoopPeelingPhase>();
     }
 
-    if (v8_flags.turboshaft_loop_unrolling) {
+    if (v8_flags.turboshaft_loop_unrolling &&
+        WithinCompileBudget(turboshaft::LoopUnrollingPhase::phase_name())) {
       Run<turboshaft::LoopUnrollingPhase>();
     }
 
-    if (v8_flags.turbo_store_elimination) {
+    if (v8_flags.turbo_store_elimination &&
+        WithinCompileBudget(
+            turboshaft::StoreStoreEliminationPhase::phase_name())) {
       Run<turboshaft::StoreStoreEliminationPhase>();
     }
 
     Run<turboshaft::OptimizePhase>();
 
-    if (v8_flags.turboshaft_typed_optimizations) {
+    if (v8_flags.turboshaft_typed_optimizations &&
+        WithinCompileBudget(
+            turboshaft::TypedOptimizationsPhase::phase_name())) {
       Run<turboshaft::TypedOptimizationsPhase>();
     }
 
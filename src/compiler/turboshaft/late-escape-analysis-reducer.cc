@@ -76,9 +76,92 @@ bool LateEscapeAnalysisAnalyzer::EscapesThroughUse(OpIndex alloc,
     // {alloc}, but not if it writes **to** {alloc}.
     return store_op->value() == alloc;
   }
+  if (const LoadOp* load_op = op.TryCast<LoadOp>()) {
+    // A LoadOp from {alloc} doesn't make it escape if the loaded value can be
+    // forwarded from the store that initialized the field.
+    if (load_op->base() == alloc && !load_op->index().valid()) {
+      return !FindForwardableStore(alloc, using_op_idx).valid();
+    }
+  }
   return true;
 }
 
+namespace {
+
+// Returns true if loading a value of representation {rep} gives back exactly
+// the value that was stored (ie, no truncation or extension is involved).
+bool IsForwardableRepresentation(MemoryRepresentation rep) {
+  switch (rep) {
+    case MemoryRepresentation::AnyTagged():
+    case MemoryRepresentation::TaggedPointer():
+    case MemoryRepresentation::TaggedSigned():
+    case MemoryRepresentation::Int32():
+    case MemoryRepresentation::Uint32():
+    case MemoryRepresentation::Int64():
+    case MemoryRepresentation::Uint64():
+    case MemoryRepresentation::Float32():
+    case MemoryRepresentation::Float64():
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool Overlap(int32_t offset1, uint8_t size1, int32_t offset2, uint8_t size2) {
+  return offset1 < offset2 + size2 && offset2 < offset1 + size1;
+}
+
+}  // namespace
+
+// Returns the store to {alloc} whose value {load_idx} (which loads from
+// {alloc}) can be replaced with, or an invalid index if there is none. This
+// is the case if the store is the only one writing to the loaded field, it
+// writes the field with the same representation, and it dominates the load.
+OpIndex LateEscapeAnalysisAnalyzer::FindForwardableStore(OpIndex alloc,
+                                                         OpIndex load_idx) {
+  const LoadOp& load = graph_.Get(load_idx).Cast<LoadOp>();
+  if (load.kind.is_atomic || !IsForwardableRepresentation(load.loaded_rep) ||
+      load.result_rep != load.loaded_rep.ToRegisterRepresentation()) {
+    return OpIndex::Invalid();
+  }
+  const uint8_t load_size = load.loaded_rep.SizeInBytes();
+
+  OpIndex forwardable_store = OpIndex::Invalid();
+  for (OpIndex use : alloc_uses_.at(alloc)) {
+    const StoreOp* store = graph_.Get(use).TryCast<StoreOp>();
+    if (!store || store->base() != alloc) continue;
+    if (store->index().valid()) {
+      // We can't tell which field is written.
+      return OpIndex::Invalid();
+    }
+    if (!Overlap(store->offset, store->stored_rep.SizeInBytes(), load.offset,
+                 load_size)) {
+      continue;
+    }
+    if (forwardable_store.valid() || store->offset != load.offset ||
+        store->stored_rep != load.loaded_rep ||
+        store->kind.tagged_base != load.kind.tagged_base) {
+      return OpIndex::Invalid();
+    }
+    if (graph_.Get(store->value()).Is<AllocateOp>()) {
+      // Forwarding would add uses to the stored allocation, which could be
+      // removed itself once {alloc} is removed.
+      return OpIndex::Invalid();
+    }
+    forwardable_store = use;
+  }
+  if (!forwardable_store.valid()) return OpIndex::Invalid();
+
+  const Block& store_block = graph_.Get(graph_.BlockOf(forwardable_store));
+  const Block& load_block = graph_.Get(graph_.BlockOf(load_idx));
+  if (&store_block == &load_block) {
+    if (load_idx < forwardable_store) return OpIndex::Invalid();
+  } else if (!load_block.IsDominatedBy(&store_block)) {
+    return OpIndex::Invalid();
+  }
+  return forwardable_store;
+}
+
 void LateEscapeAnalysisAnalyzer::MarkToRemove(OpIndex alloc) {
   if (ShouldSkipOptimizationStep()) return;
   graph_.MarkAsUnused(alloc);
@@ -86,8 +169,18 @@ void LateEscapeAnalysisAnalyzer::MarkToRemove(OpIndex alloc) {
     return;
   }
 
-  // The uses of {alloc} should also be skipped.
+  // Loads from {alloc} are replaced by the stored values. This has to happen
+  // before the stores are marked as unused.
+  for (OpIndex use : alloc_uses_.at(alloc)) {
+    if (!graph_.Get(use).Is<LoadOp>()) continue;
+    OpIndex store_idx = FindForwardableStore(alloc, use);
+    DCHECK(store_idx.valid());
+    load_replacements_[use] = graph_.Get(store_idx).Cast<StoreOp>().value();
+  }
+
+  // The other uses of {alloc} should also be skipped.
   for (OpIndex use : alloc_uses_.at(alloc)) {
+    if (graph_.Get(use).Is<LoadOp>()) continue;
     graph_.MarkAsUnused(use);
     const StoreOp& store = graph_.Get(use).Cast<StoreOp>();
     if (graph_.Get(store.value()).Is<AllocateOp>()) {
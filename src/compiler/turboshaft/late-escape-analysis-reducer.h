@@ -14,15 +14,29 @@
 namespace v8::internal::compiler::turboshaft {
 
 // LateEscapeAnalysis removes allocation that have no uses besides the stores
-// initializing the object.
+// initializing the object and loads of fields that were written exactly once
+// by a dominating store. Such loads are replaced by the stored value (scalar
+// replacement), which makes the allocation and its stores dead.
 
 class LateEscapeAnalysisAnalyzer {
  public:
   LateEscapeAnalysisAnalyzer(Graph& graph, Zone* zone)
-      : graph_(graph), phase_zone_(zone), alloc_uses_(zone), allocs_(zone) {}
+      : graph_(graph),
+        phase_zone_(zone),
+        alloc_uses_(zone),
+        allocs_(zone),
+        load_replacements_(zone) {}
 
   void Run();
 
+  // Returns the input graph value that the load {load} should be replaced
+  // with, or an invalid index if {load} should be kept.
+  OpIndex GetLoadReplacement(OpIndex load) const {
+    auto it = load_replacements_.find(load);
+    if (it == load_replacements_.end()) return OpIndex::Invalid();
+    return it->second;
+  }
+
  private:
   void RecordAllocateUse(OpIndex alloc, OpIndex use);
 
@@ -30,6 +44,7 @@ class LateEscapeAnalysisAnalyzer {
   void FindRemovableAllocations();
   bool AllocationIsEscaping(OpIndex alloc);
   bool EscapesThroughUse(OpIndex alloc, OpIndex using_op_idx);
+  OpIndex FindForwardableStore(OpIndex alloc, OpIndex load_idx);
   void MarkToRemove(OpIndex alloc);
 
   Graph& graph_;
@@ -41,6 +56,9 @@ class LateEscapeAnalysisAnalyzer {
   // iterated upon to determine which allocations can be removed and which
   // cannot.
   ZoneVector<OpIndex> allocs_;
+  // {load_replacements_} maps loads from removed allocations to the value of
+  // the (unique) store that initialized the loaded field.
+  ZoneAbslFlatHashMap<OpIndex, OpIndex> load_replacements_;
 };
 
 template <class Next>
@@ -53,6 +71,14 @@ class LateEscapeAnalysisReducer : public Next {
     Next::Analyze();
   }
 
+  OpIndex REDUCE_INPUT_GRAPH(Load)(OpIndex ig_index, const LoadOp& load) {
+    OpIndex replacement = analyzer_.GetLoadReplacement(ig_index);
+    if (replacement.valid()) {
+      return Asm().MapToNewGraph(replacement);
+    }
+    return Next::ReduceInputGraphLoad(ig_index, load);
+  }
+
  private:
   LateEscapeAnalysisAnalyzer analyzer_{Asm().modifiable_input_graph(),
                                        Asm().phase_zone()};
@@ -12,6 +12,9 @@ namespace v8::internal::compiler::turboshaft {
 void LoopUnrollingAnalyzer::DetectUnrollableLoops() {
   for (const auto& [start, info] : loop_finder_.LoopHeaders()) {
     if (!info.has_inner_loops) {
+      if (!PipelineData::Get().is_wasm() && IsRawMemoryLoop(info)) {
+        raw_memory_loops_.insert(start);
+      }
       int iter_count;
       if (CanFullyUnrollLoop(info, &iter_count)) {
         loop_iteration_count_.insert({start, iter_count});
@@ -62,6 +65,26 @@ bool LoopUnrollingAnalyzer::CanFullyUnrollLoop(const LoopFinder::LoopInfo& info,
       branch->condition(), loop_if_cond_is, iter_count);
 }
 
+bool LoopUnrollingAnalyzer::IsRawMemoryLoop(const LoopFinder::LoopInfo& info) {
+  if (info.op_count >= kJSMaxRawMemoryLoopSizeForPartialUnrolling) {
+    return false;
+  }
+  // Typed array element accesses are lowered to loads and stores with an
+  // untagged base (the data pointer of the typed array).
+  size_t raw_access_count = 0;
+  for (const Block* block : loop_finder_.GetLoopBody(info.start)) {
+    for (const Operation& op : input_graph_->operations(*block)) {
+      if (const LoadOp* load = op.TryCast<LoadOp>()) {
+        if (!load->kind.tagged_base) raw_access_count++;
+      } else if (const StoreOp* store = op.TryCast<StoreOp>()) {
+        if (!store->kind.tagged_base) raw_access_count++;
+      }
+    }
+  }
+  return raw_access_count > 0 &&
+         raw_access_count * kRawMemoryAccessOpRatio >= info.op_count;
+}
+
 // Tries to match `phi cmp cst` (or `cst cmp phi`).
 bool StaticCanonicalForLoopMatcher::MatchPhiCompareCst(
     OpIndex cond_idx, StaticCanonicalForLoopMatcher::CmpOp* cmp_op,
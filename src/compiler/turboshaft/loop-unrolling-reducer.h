@@ -112,6 +112,7 @@ class LoopUnrollingAnalyzer {
         matcher_(*input_graph),
         loop_finder_(phase_zone, input_graph),
         loop_iteration_count_(phase_zone),
+        raw_memory_loops_(phase_zone),
         canonical_loop_matcher_(matcher_, kPartialUnrollingCount) {
     DetectUnrollableLoops();
   }
@@ -127,8 +128,11 @@ class LoopUnrollingAnalyzer {
   bool ShouldPartiallyUnrollLoop(const Block* loop_header) const {
     DCHECK(loop_header->IsLoop());
     auto info = loop_finder_.GetLoopInfo(loop_header);
-    return !info.has_inner_loops &&
-           info.op_count < kMaxLoopSizeForPartialUnrolling;
+    if (info.has_inner_loops) return false;
+    if (raw_memory_loops_.count(loop_header)) {
+      return info.op_count < kJSMaxRawMemoryLoopSizeForPartialUnrolling;
+    }
+    return info.op_count < kMaxLoopSizeForPartialUnrolling;
   }
 
   bool ShouldRemoveLoop(const Block* loop_header) const {
@@ -160,6 +164,12 @@ class LoopUnrollingAnalyzer {
   static constexpr size_t kMaxLoopSizeForFullUnrolling = 150;
   static constexpr size_t kJSMaxLoopSizeForPartialUnrolling = 50;
   static constexpr size_t kWasmMaxLoopSizeForPartialUnrolling = 80;
+  // JS loops that mostly access raw memory (typically typed array kernels
+  // like elementwise map/reduce) are allowed to be as large as Wasm loops.
+  static constexpr size_t kJSMaxRawMemoryLoopSizeForPartialUnrolling = 80;
+  // A loop is considered to mostly access raw memory if it has at least one
+  // untagged-base load or store per {kRawMemoryAccessOpRatio} operations.
+  static constexpr size_t kRawMemoryAccessOpRatio = 16;
   static constexpr size_t kMaxLoopIterationsForFullUnrolling = 4;
   static constexpr size_t kPartialUnrollingCount = 4;
 
@@ -167,6 +177,7 @@ class LoopUnrollingAnalyzer {
   void DetectUnrollableLoops();
   bool CanFullyUnrollLoop(const LoopFinder::LoopInfo& info,
                           int* iter_count) const;
+  bool IsRawMemoryLoop(const LoopFinder::LoopInfo& info);
 
   Graph* input_graph_;
   OperationMatcher matcher_;
@@ -175,6 +186,9 @@ class LoopUnrollingAnalyzer {
   // doesn't contain entries for loops for which we don't know the number of
   // iterations.
   ZoneUnorderedMap<const Block*, int> loop_iteration_count_;
+  // {raw_memory_loops_} contains the headers of the JS inner loops for which
+  // IsRawMemoryLoop holds.
+  ZoneSet<const Block*, LoopFinder::BlockCmp> raw_memory_loops_;
   const StaticCanonicalForLoopMatcher canonical_loop_matcher_;
   const size_t kMaxLoopSizeForPartialUnrolling =
       PipelineData::Get().is_wasm() ? kWasmMaxLoopSizeForPartialUnrolling
@@ -6046,6 +6046,13 @@ int Shell::Main(int argc, char* argv[]) {
         WriteIgnitionDispatchCountersFile(isolate);
       }
 
+      if (i::v8_flags.trace_ignition_dispatches_top_pairs > 0) {
+        reinterpret_cast<i::Isolate*>(isolate)
+            ->interpreter()
+            ->PrintTopDispatchPairs(
+                std::cout, i::v8_flags.trace_ignition_dispatches_top_pairs);
+      }
+
       if (options.cpu_profiler) {
         CpuProfile* profile =
             cpu_profiler->StopProfiling(String::Empty(isolate));
@@ -0,0 +1,48 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/deoptimizer/deoptimization-stats.h"
+
+#include <limits>
+
+#include "src/objects/script.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+int DeoptimizationStats::Record(Tagged<SharedFunctionInfo> shared,
+                                DeoptimizeReason reason) {
+  const int index = static_cast<int>(reason);
+  counts_[index]++;
+
+  Tagged<Object> script = shared->script();
+  if (!IsScript(script)) return 1;
+  const uint64_t key =
+      (static_cast<uint64_t>(static_cast<uint32_t>(
+           Script::cast(script)->id()))
+       << 32) |
+      static_cast<uint32_t>(shared->function_literal_id());
+
+  auto it = functions_.find(key);
+  if (it == functions_.end()) {
+    if (functions_.size() >= kMaxTrackedFunctions) return 1;
+    it = functions_.emplace(key, Histogram{}).first;
+  }
+  uint16_t& count = it->second[index];
+  if (count < std::numeric_limits<uint16_t>::max()) count++;
+  return count;
+}
+
+size_t DeoptimizationStats::function_count(DeoptimizeReason reason) const {
+  const int index = static_cast<int>(reason);
+  size_t result = 0;
+  for (const auto& [key, histogram] : functions_) {
+    if (histogram[index] > 0) result++;
+  }
+  return result;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,61 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_DEOPTIMIZER_DEOPTIMIZATION_STATS_H_
+#define V8_DEOPTIMIZER_DEOPTIMIZATION_STATS_H_
+
+#include <array>
+#include <unordered_map>
+
+#include "src/deoptimizer/deoptimize-reason.h"
+#include "src/objects/tagged.h"
+
+namespace v8 {
+namespace internal {
+
+class SharedFunctionInfo;
+
+// Counts the eager deoptimizations of an isolate by reason, both in total and
+// per function, so that functions that keep failing the same speculation
+// (a "deopt storm") can be detected.
+class DeoptimizationStats {
+ public:
+  // Records an eager deopt of {shared} for {reason} and returns how often
+  // that function has deoptimized for {reason} so far.
+  int Record(Tagged<SharedFunctionInfo> shared, DeoptimizeReason reason);
+
+  // Records that the feedback a deopt for {reason} speculated on has been
+  // widened.
+  void RecordDespeculation(DeoptimizeReason reason) {
+    despeculations_[static_cast<int>(reason)]++;
+  }
+
+  size_t count(DeoptimizeReason reason) const {
+    return counts_[static_cast<int>(reason)];
+  }
+  size_t despeculation_count(DeoptimizeReason reason) const {
+    return despeculations_[static_cast<int>(reason)];
+  }
+  // The number of tracked functions that deoptimized at least once for
+  // {reason}.
+  size_t function_count(DeoptimizeReason reason) const;
+
+ private:
+  // Bounds the memory used for the per-function histograms. Functions that
+  // deopt after the limit is reached only contribute to the totals.
+  static constexpr size_t kMaxTrackedFunctions = 4096;
+
+  using Histogram = std::array<uint16_t, kDeoptimizeReasonCount>;
+
+  std::array<size_t, kDeoptimizeReasonCount> counts_ = {};
+  std::array<size_t, kDeoptimizeReasonCount> despeculations_ = {};
+  // Keyed by script id and function literal id, which unlike the
+  // SharedFunctionInfo itself are stable across GCs.
+  std::unordered_map<uint64_t, Histogram> functions_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_DEOPTIMIZER_DEOPTIMIZATION_STATS_H_
@@ -9,6 +9,7 @@
 #include "src/codegen/register-configuration.h"
 #include "src/codegen/reloc-info.h"
 #include "src/debug/debug.h"
+#include "src/deoptimizer/deoptimization-stats.h"
 #include "src/deoptimizer/deoptimized-frame-info.h"
 #include "src/deoptimizer/materialized-object-store.h"
 #include "src/deoptimizer/translated-state.h"
@@ -18,6 +19,7 @@
 #include "src/execution/v8threads.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/heap-inl.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
@@ -2155,6 +2157,109 @@ void Deoptimizer::MaterializeHeapObjects() {
       static_cast<Address>(stack_fp_));
 }
 
+namespace {
+
+// Returns the feedback slot of the speculating bytecode at {offset}, or an
+// invalid slot if the bytecode doesn't speculate on feedback that
+// FeedbackNexus::Despeculate can widen.
+FeedbackSlot GetSpeculatedFeedbackSlot(Handle<BytecodeArray> bytecode_array,
+                                       int offset) {
+  if (offset < 0 || offset >= bytecode_array->length()) return {};
+  interpreter::BytecodeArrayIterator iterator(bytecode_array, offset);
+  switch (iterator.current_bytecode()) {
+    case interpreter::Bytecode::kInc:
+    case interpreter::Bytecode::kDec:
+    case interpreter::Bytecode::kNegate:
+    case interpreter::Bytecode::kBitwiseNot:
+      return iterator.GetSlotOperand(0);
+    case interpreter::Bytecode::kAdd:
+    case interpreter::Bytecode::kSub:
+    case interpreter::Bytecode::kMul:
+    case interpreter::Bytecode::kDiv:
+    case interpreter::Bytecode::kMod:
+    case interpreter::Bytecode::kExp:
+    case interpreter::Bytecode::kBitwiseOr:
+    case interpreter::Bytecode::kBitwiseXor:
+    case interpreter::Bytecode::kBitwiseAnd:
+    case interpreter::Bytecode::kShiftLeft:
+    case interpreter::Bytecode::kShiftRight:
+    case interpreter::Bytecode::kShiftRightLogical:
+    case interpreter::Bytecode::kAddSmi:
+    case interpreter::Bytecode::kSubSmi:
+    case interpreter::Bytecode::kMulSmi:
+    case interpreter::Bytecode::kDivSmi:
+    case interpreter::Bytecode::kModSmi:
+    case interpreter::Bytecode::kExpSmi:
+    case interpreter::Bytecode::kBitwiseOrSmi:
+    case interpreter::Bytecode::kBitwiseXorSmi:
+    case interpreter::Bytecode::kBitwiseAndSmi:
+    case interpreter::Bytecode::kShiftLeftSmi:
+    case interpreter::Bytecode::kShiftRightSmi:
+    case interpreter::Bytecode::kShiftRightLogicalSmi:
+    case interpreter::Bytecode::kTestEqual:
+    case interpreter::Bytecode::kTestEqualStrict:
+    case interpreter::Bytecode::kTestLessThan:
+    case interpreter::Bytecode::kTestGreaterThan:
+    case interpreter::Bytecode::kTestLessThanOrEqual:
+    case interpreter::Bytecode::kTestGreaterThanOrEqual:
+    case interpreter::Bytecode::kGetKeyedProperty:
+      return iterator.GetSlotOperand(1);
+    case interpreter::Bytecode::kGetNamedProperty:
+      return iterator.GetSlotOperand(2);
+    default:
+      return {};
+  }
+}
+
+}  // namespace
+
+void Deoptimizer::RecordDeoptimizationStats() {
+  DCHECK_EQ(deopt_kind_, DeoptimizeKind::kEager);
+  const DeoptimizeReason reason = GetDeoptInfo().deopt_reason;
+
+  // The check that failed belongs to the innermost unoptimized frame.
+  TranslatedFrame* frame = nullptr;
+  for (auto it = translated_state_.frames().rbegin();
+       it != translated_state_.frames().rend(); ++it) {
+    if (it->kind() == TranslatedFrame::kUnoptimizedFunction) {
+      frame = &*it;
+      break;
+    }
+  }
+  if (frame == nullptr) return;
+
+  Tagged<SharedFunctionInfo> shared = frame->raw_shared_info();
+  DeoptimizationStats* stats = isolate()->deoptimization_stats();
+  const int count = stats->Record(shared, reason);
+  if (v8_flags.deopt_storm_threshold <= 0 ||
+      count < v8_flags.deopt_storm_threshold || !shared->HasBytecodeArray()) {
+    return;
+  }
+
+  // Rather than giving up on optimizing the function, stop speculating on the
+  // feedback of the bytecode that keeps deoptimizing. The closure is the first
+  // value of an unoptimized frame.
+  Handle<Object> closure = frame->begin()->GetValue();
+  if (!IsJSFunction(*closure)) return;
+  Tagged<JSFunction> function = Tagged<JSFunction>::cast(*closure);
+  if (!function->has_feedback_vector()) return;
+  const int bytecode_offset = frame->bytecode_offset().ToInt();
+  FeedbackSlot slot = GetSpeculatedFeedbackSlot(
+      handle(shared->GetBytecodeArray(isolate()), isolate()), bytecode_offset);
+  if (slot.IsInvalid()) return;
+
+  FeedbackNexus nexus(handle(function->feedback_vector(), isolate()), slot);
+  if (!nexus.Despeculate()) return;
+  stats->RecordDespeculation(reason);
+  if (tracing_enabled()) {
+    PrintF(trace_scope()->file(),
+           "[bailout: despeculating feedback slot %d at bytecode offset %d of "
+           "%s after %d deopts (reason: %s)]\n",
+           slot.ToInt(), bytecode_offset, shared->DebugNameCStr().get(), count,
+           DeoptimizeReasonToString(reason));
+  }
+}
+
 void Deoptimizer::QueueValueForMaterialization(
     Address output_address, Tagged<Object> obj,
     const TranslatedFrame::iterator& iterator) {
@@ -72,6 +72,12 @@ class Deoptimizer : public Malloced {
     return bytecode_offset_in_outermost_frame_;
   }
 
+  // Accounts this eager deopt in the isolate's DeoptimizationStats and, once
+  // the deopting function has failed the same kind of check often enough,
+  // widens the feedback that the failing check speculated on. Must be called
+  // after the heap objects have been materialized.
+  void RecordDeoptimizationStats();
+
   static Deoptimizer* New(Address raw_function, DeoptimizeKind kind,
                           Address from, int fp_to_sp_delta, Isolate* isolate);
   static Deoptimizer* Grab(Isolate* isolate);
@@ -42,6 +42,7 @@
 #include "src/date/date.h"
 #include "src/debug/debug-frames.h"
 #include "src/debug/debug.h"
+#include "src/deoptimizer/deoptimization-stats.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/deoptimizer/materialized-object-store.h"
 #include "src/diagnostics/basic-block-profiler.h"
@@ -4075,6 +4076,9 @@ Isolate::~Isolate() {
   delete materialized_object_store_;
   materialized_object_store_ = nullptr;
 
+  delete deoptimization_stats_;
+  deoptimization_stats_ = nullptr;
+
   delete v8_file_logger_;
   v8_file_logger_ = nullptr;
 
@@ -4638,6 +4642,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   store_stub_cache_ = new StubCache(this);
   define_own_stub_cache_ = new StubCache(this);
   materialized_object_store_ = new MaterializedObjectStore(this);
+  deoptimization_stats_ = new DeoptimizationStats();
   regexp_stack_ = new RegExpStack();
   date_cache_ = new DateCache();
   heap_profiler_ = new HeapProfiler(heap());
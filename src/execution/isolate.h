@@ -119,6 +119,7 @@ class CompilationCache;
 class CompilationStatistics;
 class Counters;
 class Debug;
+class DeoptimizationStats;
 class Deoptimizer;
 class DescriptorLookupCache;
 class EmbeddedFileWriterInterface;
@@ -1317,6 +1318,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return materialized_object_store_;
   }
 
+  DeoptimizationStats* deoptimization_stats() const {
+    return deoptimization_stats_;
+  }
+
   DescriptorLookupCache* descriptor_lookup_cache() const {
     return descriptor_lookup_cache_;
   }
@@ -2376,6 +2381,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   Deoptimizer* current_deoptimizer_ = nullptr;
   bool deoptimizer_lazy_throw_ = false;
   MaterializedObjectStore* materialized_object_store_ = nullptr;
+  DeoptimizationStats* deoptimization_stats_ = nullptr;
   bool capture_stack_trace_for_uncaught_exceptions_ = false;
   int stack_trace_for_uncaught_exceptions_frame_limit_ = 0;
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_ =
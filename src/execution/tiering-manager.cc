@@ -325,7 +325,17 @@ void TieringManager::MaybeOptimizeFrame(Tagged<JSFunction> function,
 
     // OSR kicks in only once we've previously decided to tier up, but we are
     // still in a lower-tier frame (this implies a long-running loop).
-    TryIncrementOsrUrgency(isolate_, function);
+    if (V8_UNLIKELY(v8_flags.maglev_osr_from_hot_loops &&
+                    current_code_kind == CodeKind::MAGLEV &&
+                    function->HasAvailableCodeKind(isolate_,
+                                                   CodeKind::TURBOFAN))) {
+      // Turbofan code is ready but this Maglev frame keeps ticking, so it is
+      // stuck in a loop. Leave it at the next loop header rather than
+      // waiting for the urgency to climb one tick at a time.
+      TryRequestOsrAtNextOpportunity(isolate_, function);
+    } else {
+      TryIncrementOsrUrgency(isolate_, function);
+    }
 
     // Return unconditionally and don't run through the optimization decision
     // again; we've already decided to tier up previously.
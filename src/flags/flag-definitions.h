@@ -556,6 +556,9 @@ DEFINE_BOOL_READONLY(
 
 DEFINE_BOOL(maglev_inlining, true,
             "enable inlining in the maglev optimizing compiler")
+DEFINE_BOOL(maglev_feedback_cell_calls, true,
+            "specialize (and inline) calls whose feedback is a feedback cell "
+            "shared by several closures of the same function")
 DEFINE_BOOL(maglev_loop_peeling, true,
             "enable loop peeling in the maglev optimizing compiler")
 DEFINE_INT(maglev_loop_peeling_max_size, 150,
@@ -855,6 +858,10 @@ DEFINE_BOOL(osr_from_maglev, false,
 DEFINE_BOOL(always_osr_from_maglev, false,
             "whether we try to OSR to Turbofan from any Maglev")
 DEFINE_VALUE_IMPLICATION(always_osr_from_maglev, osr_from_maglev, true)
+DEFINE_BOOL(maglev_osr_from_hot_loops, false,
+            "whether we try to OSR to Turbofan from loops in (non-OSR'd) "
+            "Maglev code that keep running after Turbofan code is available")
+DEFINE_IMPLICATION(maglev_osr_from_hot_loops, osr_from_maglev)
 
 // Tiering: Turbofan.
 DEFINE_INT(invocation_count_for_turbofan, 3000,
@@ -904,6 +911,10 @@ DEFINE_BOOL(stress_ic, false, "exercise interesting paths in ICs more often")
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
             "elide bytecodes which won't have any external effect")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
+DEFINE_BOOL(ignition_reo_across_conditional_jumps, false,
+            "keep the accumulator's register equivalences on the fall-through "
+            "path of conditional jumps")
+DEFINE_NEG_IMPLICATION(ignition_reo, ignition_reo_across_conditional_jumps)
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
@@ -942,6 +953,10 @@ DEFINE_STRING(
     trace_ignition_dispatches_output_file, nullptr,
     "write the bytecode handler dispatch table to the specified file (d8 only) "
     "(requires building with v8_enable_ignition_dispatch_counting)")
+DEFINE_INT(trace_ignition_dispatches_top_pairs, 0,
+           "print the N most frequent bytecode dispatch pairs on exit, as "
+           "candidates for superinstructions (d8 only) "
+           "(requires building with v8_enable_ignition_dispatch_counting)")
 
 DEFINE_BOOL(trace_track_allocation_sites, false,
             "trace the tracking of allocation sites")
@@ -958,8 +973,13 @@ DEFINE_BOOL(trace_generalization, false, "trace map generalization")
 DEFINE_BOOL(sparkplug, ENABLE_SPARKPLUG_BY_DEFAULT,
             "enable Sparkplug baseline compiler")
 DEFINE_BOOL(always_sparkplug, false, "directly tier up to Sparkplug code")
+DEFINE_BOOL(sparkplug_on_load, false,
+            "compile the eagerly compiled functions of a script with Sparkplug "
+            "right after generating their bytecode, in the background if "
+            "concurrent Sparkplug is enabled")
 #if V8_ENABLE_SPARKPLUG
 DEFINE_IMPLICATION(always_sparkplug, sparkplug)
+DEFINE_IMPLICATION(sparkplug_on_load, sparkplug)
 DEFINE_BOOL(baseline_batch_compilation, true, "batch compile Sparkplug code")
 #if defined(V8_OS_DARWIN) && defined(V8_HOST_ARCH_ARM64) && \
     !V8_HEAP_USE_PTHREAD_JIT_WRITE_PROTECT
@@ -1184,6 +1204,16 @@ DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size_absolute,
 DEFINE_VALUE_IMPLICATION(stress_inline, min_inlining_frequency, 0.)
 DEFINE_IMPLICATION(stress_inline, polymorphic_inlining)
 DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
+DEFINE_BOOL(turbo_inlining_cost_model, false,
+            "discount the size of inlining candidates by the estimated "
+            "benefit of specializing them to their call site arguments")
+DEFINE_INT(turbo_inlining_max_benefit_percent, 50,
+           "maximum percentage of a candidate's bytecode size that the "
+           "inlining cost model may discount")
+DEFINE_BOOL(trace_turbo_inlining_cost_model, false,
+            "trace the predicted and achieved size of TurboFan inlining "
+            "decisions")
+DEFINE_IMPLICATION(trace_turbo_inlining_cost_model, turbo_inlining_cost_model)
 DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
@@ -1243,6 +1273,14 @@ DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "TurboFan allocation folding")
+DEFINE_INT(turbo_compile_time_budget, 0,
+           "time budget (in ms) of a single TurboFan job after which optional "
+           "optimization phases are skipped (0 means no budget)")
+DEFINE_INT(turbo_compile_memory_budget, 0,
+           "zone memory budget (in MB) of a single TurboFan job after which "
+           "optional optimization phases are skipped (0 means no budget)")
+DEFINE_BOOL(trace_turbo_compile_budget, false,
+            "trace TurboFan jobs exceeding their compile budget")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
@@ -1827,6 +1865,9 @@ DEFINE_GENERIC_IMPLICATION(
 DEFINE_SIZE_T(
     zone_stats_tolerance, 1 * MB,
     "report a tick only when allocated zone memory changes by this amount")
+DEFINE_SIZE_T(zone_segment_pool_size, 1024,
+              "maximum size (in KB) of returned zone segments that each "
+              "allocator keeps for reuse (0 disables pooling)")
 DEFINE_BOOL(trace_zone_type_stats, false, "trace per-type zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
@@ -2064,6 +2105,18 @@ DEFINE_BOOL(
     merge_background_deserialized_script_with_compilation_cache, true,
     "After deserializing code cache data on a background thread, merge it into "
     "an existing Script if one is found in the Isolate compilation cache")
+DEFINE_BOOL(code_cache_startup_profile, false,
+            "mark functions compiled during startup so that code caches "
+            "recompile them in parallel on load if their bytecode was flushed "
+            "before the cache was created")
+DEFINE_IMPLICATION(code_cache_startup_profile, lazy_compile_dispatcher)
+DEFINE_INT(code_cache_startup_profile_ms, 0,
+           "length of the startup window recorded by "
+           "--code-cache-startup-profile in milliseconds (0 for unlimited)")
+DEFINE_BOOL(code_cache_age_deserialized_bytecode, false,
+            "treat bytecode deserialized from a code cache as almost old, so "
+            "that functions which don't run soon after loading are flushed by "
+            "the next full GC")
 DEFINE_BOOL(disable_old_api_accessors, false,
             "Disable old-style API accessors whose setters trigger through the "
             "prototype chain")
@@ -2148,6 +2201,10 @@ DEFINE_BOOL(trace_deopt, false, "trace deoptimization")
 DEFINE_BOOL(log_deopt, false, "log deoptimization")
 DEFINE_BOOL(trace_deopt_verbose, false, "extra verbose deoptimization tracing")
 DEFINE_IMPLICATION(trace_deopt_verbose, trace_deopt)
+DEFINE_INT(deopt_storm_threshold, 0,
+           "number of eager deopts of a function for the same reason after "
+           "which the feedback that the failing check speculated on is "
+           "widened (0 means never)")
 DEFINE_BOOL(trace_file_names, false,
             "include file names in trace-opt/trace-deopt output")
 DEFINE_BOOL(always_turbofan, false, "always try to optimize functions")
@@ -2185,6 +2242,15 @@ DEFINE_IMPLICATION(parallel_compile_tasks_for_eager_toplevel,
 DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
             "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
+DEFINE_BOOL(parallel_compile_tasks_for_likely_called, false,
+            "spawn parallel compile tasks for lazily compiled top-level "
+            "function declarations that are called from top-level code")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_likely_called,
+                   lazy_compile_dispatcher)
+DEFINE_INT(parallel_compile_tasks_min_function_size, 0,
+           "minimum source length of a lazy function literal for which a "
+           "parallel compile task is posted; smaller functions are compiled "
+           "lazily on the main thread")
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
@@ -2282,6 +2348,11 @@ DEFINE_BOOL(super_ic, true, "use an IC for super property loads")
 
 DEFINE_BOOL(mega_dom_ic, false, "use MegaDOM IC state for API objects")
 
+// json-parser.cc
+DEFINE_BOOL(json_parse_nested_feedback, true,
+            "predict the shape of objects nested in JSON array elements from "
+            "the same field of the previous element")
+
 // objects.cc
 DEFINE_BOOL(trace_prototype_users, false,
             "Trace updates to prototype user tracking")
@@ -2417,8 +2488,18 @@ DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
             "default in debug builds and once per process for Android.")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
+DEFINE_BOOL(parallel_snapshot_decompression, false,
+            "Decompress the startup snapshot on a worker thread while the "
+            "read-only and shared heap snapshots are decompressed")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+
+// snapshot-compression.cc
+DEFINE_INT(snapshot_compression_level, -1,
+           "zlib level for compressing snapshots: 0 stores the data without "
+           "compression for the fastest decompression at startup, 9 gives the "
+           "best ratio, -1 uses zlib's default")
+
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
@@ -2911,6 +2992,7 @@ DEFINE_NEG_IMPLICATION(predictable, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(predictable, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_likely_called)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(predictable, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(predictable, maglev_build_code_on_background)
@@ -2938,6 +3020,9 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded,
+                       parallel_compile_tasks_for_likely_called)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_snapshot_decompression)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
@@ -11,6 +11,7 @@
 #include "src/heap/combined-heap.h"
 #include "src/heap/heap.h"
 #include "src/objects/heap-object-inl.h"
+#include "src/objects/literal-objects-inl.h"
 #include "src/sandbox/external-pointer-table.h"
 
 namespace v8 {
@@ -116,10 +117,12 @@ class Committee final {
 #define PROMO_CANDIDATE_TYPE_LIST(V) \
   V(AccessCheckInfo)                 \
   V(AccessorInfo)                    \
+  V(ArrayBoilerplateDescription)     \
   V(CallHandlerInfo)                 \
   V(Code)                            \
   V(CodeWrapper)                     \
   V(InterceptorInfo)                 \
+  V(ObjectBoilerplateDescription)    \
   V(ScopeInfo)                       \
   V(SharedFunctionInfo)              \
   V(Symbol)
@@ -128,6 +131,10 @@ class Committee final {
 
   static bool IsPromoCandidate(Isolate* isolate, Tagged<HeapObject> o) {
     const InstanceType itype = o->map(isolate)->instance_type();
+    if (InstanceTypeChecker::IsFixedArrayExact(itype)) {
+      return IsPromoCandidateCopyOnWriteFixedArray(isolate,
+                                                    FixedArray::cast(o));
+    }
 #define V(TYPE)                                            \
   if (InstanceTypeChecker::Is##TYPE(itype)) {              \
     return IsPromoCandidate##TYPE(isolate, TYPE::cast(o)); \
@@ -149,6 +156,9 @@ class Committee final {
 
   DEF_PROMO_CANDIDATE(AccessCheckInfo)
   DEF_PROMO_CANDIDATE(AccessorInfo)
+  // Boilerplate descriptions are filled in once when they are created and
+  // only read afterwards.
+  DEF_PROMO_CANDIDATE(ArrayBoilerplateDescription)
   DEF_PROMO_CANDIDATE(CallHandlerInfo)
   static bool IsPromoCandidateCode(Isolate* isolate, Tagged<Code> o) {
     return Builtins::kCodeObjectsAreInROSpace && o->is_builtin();
@@ -157,7 +167,14 @@ class Committee final {
                                           Tagged<CodeWrapper> o) {
     return IsPromoCandidateCode(isolate, o->code(isolate));
   }
+  static bool IsPromoCandidateCopyOnWriteFixedArray(Isolate* isolate,
+                                                    Tagged<FixedArray> o) {
+    // Copy-on-write arrays are never written in place; writers copy them into
+    // a fresh writable backing store first.
+    return o->map(isolate) == ReadOnlyRoots(isolate).fixed_cow_array_map();
+  }
   DEF_PROMO_CANDIDATE(InterceptorInfo)
+  DEF_PROMO_CANDIDATE(ObjectBoilerplateDescription)
   DEF_PROMO_CANDIDATE(ScopeInfo)
   static bool IsPromoCandidateSharedFunctionInfo(Isolate* isolate,
                                                  Tagged<SharedFunctionInfo> o) {
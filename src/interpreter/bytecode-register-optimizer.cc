@@ -4,6 +4,7 @@
 
 #include "src/interpreter/bytecode-register-optimizer.h"
 
+#include "src/flags/flags.h"
 #include "src/interpreter/bytecode-generator.h"
 
 namespace v8 {
@@ -281,9 +282,12 @@ BytecodeRegisterOptimizer::BytecodeRegisterOptimizer(
       max_register_index_(fixed_registers_count - 1),
       register_info_table_(zone),
       registers_needing_flushed_(zone),
+      accumulator_equivalents_(zone),
       equivalence_id_(0),
       bytecode_writer_(bytecode_writer),
       flush_required_(false),
+      keep_accumulator_across_conditional_jumps_(
+          v8_flags.ignition_reo_across_conditional_jumps),
       zone_(zone) {
   register_allocator->set_observer(this);
 
@@ -374,6 +378,27 @@ void BytecodeRegisterOptimizer::Flush() {
   flush_required_ = false;
 }
 
+void BytecodeRegisterOptimizer::FlushKeepingAccumulatorEquivalents() {
+  if (!flush_required_) return;
+
+  DCHECK(accumulator_equivalents_.empty());
+  RegisterInfo* visitor = accumulator_info_->GetEquivalent();
+  while (visitor != accumulator_info_) {
+    if (visitor->allocated()) accumulator_equivalents_.push_back(visitor);
+    visitor = visitor->GetEquivalent();
+  }
+
+  Flush();
+
+  DCHECK(accumulator_info_->materialized());
+  for (RegisterInfo* equivalent : accumulator_equivalents_) {
+    DCHECK(equivalent->materialized());
+    AddToEquivalenceSet(accumulator_info_, equivalent);
+    equivalent->set_materialized(true);
+  }
+  accumulator_equivalents_.clear();
+}
+
 void BytecodeRegisterOptimizer::OutputRegisterTransfer(
     RegisterInfo* input_info, RegisterInfo* output_info) {
   Register input = input_info->register_value();
@@ -73,10 +73,18 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
   // Prepares for |bytecode|.
   template <Bytecode bytecode, ImplicitRegisterUse implicit_register_use>
   V8_INLINE void PrepareForBytecode() {
-    if (Bytecodes::IsJump(bytecode) || Bytecodes::IsSwitch(bytecode) ||
-        bytecode == Bytecode::kDebugger ||
-        bytecode == Bytecode::kSuspendGenerator ||
-        bytecode == Bytecode::kResumeGenerator) {
+    if (Bytecodes::IsConditionalJump(bytecode) &&
+        !BytecodeOperands::WritesOrClobbersAccumulator(
+            implicit_register_use) &&
+        keep_accumulator_across_conditional_jumps_) {
+      // The jump target needs flushed state, but the fall-through path still
+      // sees the same register values, so the accumulator's equivalences can
+      // be kept for it.
+      FlushKeepingAccumulatorEquivalents();
+    } else if (Bytecodes::IsJump(bytecode) || Bytecodes::IsSwitch(bytecode) ||
+               bytecode == Bytecode::kDebugger ||
+               bytecode == Bytecode::kSuspendGenerator ||
+               bytecode == Bytecode::kResumeGenerator) {
       // All state must be flushed before emitting
       // - a jump bytecode (as the register equivalents at the jump target
       //   aren't known)
@@ -156,6 +164,11 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
   void AddToEquivalenceSet(RegisterInfo* set_member,
                            RegisterInfo* non_set_member);
 
+  // Flush, then re-add the allocated registers that were equivalent to the
+  // accumulator to its equivalence set. Each of them is materialized by the
+  // flush, so no transfers are needed to load them into the accumulator later.
+  void FlushKeepingAccumulatorEquivalents();
+
   void PushToRegistersNeedingFlush(RegisterInfo* reg);
   // Methods for finding and creating metadata for each register.
   RegisterInfo* GetRegisterInfo(Register reg) {
@@ -217,12 +230,14 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
   int register_info_table_offset_;
 
   ZoneDeque<RegisterInfo*> registers_needing_flushed_;
+  ZoneVector<RegisterInfo*> accumulator_equivalents_;
 
   // Counter for equivalence sets identifiers.
   uint32_t equivalence_id_;
 
   BytecodeWriter* bytecode_writer_;
   bool flush_required_;
+  bool keep_accumulator_across_conditional_jumps_;
   Zone* zone_;
 };
 
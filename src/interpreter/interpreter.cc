@@ -4,8 +4,11 @@
 
 #include "src/interpreter/interpreter.h"
 
+#include <algorithm>
 #include <fstream>
+#include <iomanip>
 #include <memory>
+#include <vector>
 
 #include "builtins-generated/bytecodes-builtins-list.h"
 #include "src/ast/prettyprinter.h"
@@ -420,6 +423,44 @@ Handle<JSObject> Interpreter::GetDispatchCountersObject() {
   return counters_map;
 }
 
+void Interpreter::PrintTopDispatchPairs(std::ostream& os, int count) {
+  struct DispatchPair {
+    Bytecode from;
+    Bytecode to;
+    uintptr_t counter;
+  };
+  std::vector<DispatchPair> pairs;
+  uintptr_t total = 0;
+  for (int from_index = 0; from_index < kNumberOfBytecodes; ++from_index) {
+    Bytecode from_bytecode = Bytecodes::FromByte(from_index);
+    for (int to_index = 0; to_index < kNumberOfBytecodes; ++to_index) {
+      Bytecode to_bytecode = Bytecodes::FromByte(to_index);
+      uintptr_t counter = GetDispatchCounter(from_bytecode, to_bytecode);
+      if (counter == 0) continue;
+      total += counter;
+      pairs.push_back({from_bytecode, to_bytecode, counter});
+    }
+  }
+
+  size_t limit = std::min(pairs.size(), static_cast<size_t>(count));
+  std::partial_sort(pairs.begin(), pairs.begin() + limit, pairs.end(),
+                    [](const DispatchPair& a, const DispatchPair& b) {
+                      return a.counter > b.counter;
+                    });
+
+  os << "Top " << limit << " of " << pairs.size()
+     << " bytecode dispatch pairs (" << total << " dispatches):\n";
+  for (size_t i = 0; i < limit; ++i) {
+    const DispatchPair& pair = pairs[i];
+    double percent = 100.0 * static_cast<double>(pair.counter) /
+                     static_cast<double>(total);
+    os << std::setw(12) << pair.counter << " " << std::fixed
+       << std::setprecision(2) << std::setw(6) << percent << "%  "
+       << Bytecodes::ToString(pair.from) << " -> "
+       << Bytecodes::ToString(pair.to) << "\n";
+  }
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,7 @@
 #ifndef V8_INTERPRETER_INTERPRETER_H_
 #define V8_INTERPRETER_INTERPRETER_H_
 
+#include <iosfwd>
 #include <memory>
 
 // Clients of this interface shouldn't depend on lots of interpreter internals.
@@ -71,6 +72,12 @@ class Interpreter {
 
   V8_EXPORT_PRIVATE Handle<JSObject> GetDispatchCountersObject();
 
+  // Print the |count| most frequently executed bytecode dispatch pairs, most
+  // frequent first, together with their share of all counted dispatches.
+  // Pairs that dominate this list are candidates for superinstructions, like
+  // the existing Star0-Star15 short forms.
+  V8_EXPORT_PRIVATE void PrintTopDispatchPairs(std::ostream& os, int count);
+
   void ForEachBytecode(const std::function<void(Bytecode, OperandScale)>& f);
 
   void Initialize();
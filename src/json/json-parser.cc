@@ -12,9 +12,11 @@
 #include "src/debug/debug.h"
 #include "src/execution/frames-inl.h"
 #include "src/heap/factory.h"
+#include "src/logging/counters.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/elements-kind.h"
+#include "src/objects/field-index-inl.h"
 #include "src/objects/field-type.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/map-updater.h"
@@ -24,6 +26,7 @@
 #include "src/roots/roots.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/swar.h"
 #include "src/utils/boxed-float.h"
 
 namespace v8 {
@@ -126,6 +129,41 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Returns true if the word may contain a character that ends the fast
+// scan of a JSON string: '"', '\\', a control character, or (for two-byte
+// sources) a character outside Latin1, which has to be tracked by the caller.
+template <typename Char>
+constexpr bool MayTerminateJsonStringWord(uint64_t word) {
+  if (sizeof(Char) == 2 && (word & (kLaneOnes<Char> * 0xFF00)) != 0) {
+    return true;
+  }
+  return HasLaneLessThan<Char>(word, 0x20) || HasLaneEqualTo<Char>(word, '"') ||
+         HasLaneEqualTo<Char>(word, '\\');
+}
+
+// Skips whole words of characters that can't end a JSON string. The caller
+// scans the rest character by character.
+template <typename Char>
+V8_INLINE const Char* SkipJsonStringWords(const Char* cursor,
+                                          const Char* end) {
+  while (end - cursor >= kCharsPerWord<Char> &&
+         !MayTerminateJsonStringWord<Char>(ReadCharsWord(cursor))) {
+    cursor += kCharsPerWord<Char>;
+  }
+  return cursor;
+}
+
+// Skips whole words of spaces, as found in the indentation of pretty-printed
+// JSON.
+template <typename Char>
+V8_INLINE const Char* SkipSpaceWords(const Char* cursor, const Char* end) {
+  while (end - cursor >= kCharsPerWord<Char> &&
+         ReadCharsWord(cursor) == kLaneOnes<Char> * ' ') {
+    cursor += kCharsPerWord<Char>;
+  }
+  return cursor;
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(
@@ -580,13 +618,18 @@ template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
   JsonToken local_next = JsonToken::EOS;
 
-  cursor_ = std::find_if(cursor_, end_, [&](Char c) {
-    JsonToken current = GetTokenForCharacter(c);
-    bool result = current != JsonToken::WHITESPACE;
-    if (V8_LIKELY(result)) local_next = current;
-    return result;
-  });
+  const Char* cursor = cursor_;
+  while (cursor != end_) {
+    JsonToken current = GetTokenForCharacter(*cursor);
+    if (V8_LIKELY(current != JsonToken::WHITESPACE)) {
+      local_next = current;
+      break;
+    }
+    ++cursor;
+    if (*(cursor - 1) == ' ') cursor = SkipSpaceWords(cursor, end_);
+  }
 
+  cursor_ = cursor;
   next_ = local_next;
 }
 
@@ -1015,6 +1058,7 @@ class JSDataObjectBuilder {
           isolate_);
       target_map = expected_final_map_;
     } else {
+      isolate_->counters()->json_parse_transition_lookups()->Increment();
       TransitionsAccessor transitions(isolate_, *map_);
       expected_key = transitions.ExpectedTransitionKey();
       if (!expected_key.is_null()) {
@@ -1044,6 +1088,7 @@ class JSDataObjectBuilder {
       property_count_in_expected_final_map_ = 0;
     }
 
+    isolate_->counters()->json_parse_transition_lookups()->Increment();
     MaybeHandle<Map> maybe_target =
         TransitionsAccessor(isolate_, *map_).FindTransitionToField(key);
     if (!maybe_target.ToHandle(&target_map)) return false;
@@ -1284,6 +1329,58 @@ class JsonParser<Char>::NamedPropertyIterator {
   const JsonProperty* end_;
 };
 
+template <typename Char>
+Tagged<Object> JsonParser<Char>::GetPreviousSibling(
+    const JsonContinuation& cont,
+    const std::vector<JsonContinuation>& cont_stack,
+    const SmallVector<Handle<Object>>& element_stack) {
+  DisallowGarbageCollection no_gc;
+  Tagged<Object> no_sibling = Smi::zero();
+  if (cont_stack.empty()) return no_sibling;
+
+  // An array element: the previous element of the same array.
+  const JsonContinuation& parent = cont_stack.back();
+  if (parent.type() == JsonContinuation::kArrayElement) {
+    if (parent.index >= element_stack.size()) return no_sibling;
+    return *element_stack.back();
+  }
+
+  // A property value of an object that is itself an array element, as in
+  // [{"a": {...}}, {"a": {...}}]: the value of the same field in the previous
+  // element. Records in the same array usually have the same shape all the
+  // way down.
+  if (!v8_flags.json_parse_nested_feedback) return no_sibling;
+  if (parent.type() != JsonContinuation::kObjectProperty) return no_sibling;
+  if (parent.elements > 0 || cont_stack.size() < 2) return no_sibling;
+  const JsonContinuation& grandparent = cont_stack[cont_stack.size() - 2];
+  if (grandparent.type() != JsonContinuation::kArrayElement ||
+      grandparent.index >= element_stack.size() ||
+      !IsJSObject(*element_stack.back())) {
+    return no_sibling;
+  }
+
+  Tagged<JSObject> parent_sibling = JSObject::cast(*element_stack.back());
+  Tagged<Map> parent_sibling_map = parent_sibling->map();
+  if (parent_sibling_map->is_dictionary_map()) return no_sibling;
+
+  // The property whose value is being built is the last one pushed before
+  // this object's own properties.
+  DCHECK_GT(cont.index, parent.index);
+  int descriptor = cont.index - 1 - parent.index;
+  if (descriptor >= parent_sibling_map->NumberOfOwnDescriptors()) {
+    return no_sibling;
+  }
+  PropertyDetails details =
+      parent_sibling_map->instance_descriptors(isolate_)->GetDetails(
+          InternalIndex(descriptor));
+  if (details.location() != PropertyLocation::kField ||
+      details.representation().IsDouble()) {
+    return no_sibling;
+  }
+  return parent_sibling->RawFastPropertyAt(
+      FieldIndex::ForDetails(parent_sibling_map, details));
+}
+
 template <typename Char>
 Handle<Object> JsonParser<Char>::BuildJsonObject(
     const JsonContinuation& cont,
@@ -1656,12 +1753,10 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue(Handle<Object> reviver) {
           }
 
           Handle<Map> feedback;
-          if (cont_stack.size() > 0 &&
-              cont_stack.back().type() == JsonContinuation::kArrayElement &&
-              cont_stack.back().index < element_stack.size() &&
-              IsJSObject(*element_stack.back())) {
-            Tagged<Map> maybe_feedback =
-                JSObject::cast(*element_stack.back())->map();
+          Tagged<Object> sibling =
+              GetPreviousSibling(cont, cont_stack, element_stack);
+          if (IsJSObject(sibling)) {
+            Tagged<Map> maybe_feedback = JSObject::cast(sibling)->map();
             // Don't consume feedback from objects with a map that's detached
             // from the transition tree.
             if (!maybe_feedback->IsDetached(isolate_)) {
@@ -1938,11 +2033,11 @@ void JsonParser<Char>::DecodeString(SinkChar* sink, int start, int length) {
   const Char* cursor = chars_ + start;
   while (true) {
     const Char* end = cursor + length - (sink - sink_start);
-    cursor = std::find_if(cursor, end, [&sink](Char c) {
-      if (c == '\\') return true;
-      *sink++ = c;
-      return false;
-    });
+    // Copy the run of characters up to the next escape in bulk.
+    const Char* run_end = std::find(cursor, end, '\\');
+    CopyChars(sink, cursor, run_end - cursor);
+    sink += run_end - cursor;
+    cursor = run_end;
 
     if (cursor == end) return;
 
@@ -2004,6 +2099,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    cursor_ = SkipJsonStringWords(cursor_, end_);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -326,6 +326,13 @@ class JsonParser final {
   template <bool should_track_json_source>
   MaybeHandle<Object> ParseJsonValue(Handle<Object> reviver);
 
+  // Returns the object that most likely has the same shape as the object
+  // about to be built from |cont|, or a Smi if there is none.
+  Tagged<Object> GetPreviousSibling(
+      const JsonContinuation& cont,
+      const std::vector<JsonContinuation>& cont_stack,
+      const SmallVector<Handle<Object>>& element_stack);
+
   Handle<Object> BuildJsonObject(
       const JsonContinuation& cont,
       const SmallVector<JsonProperty>& property_stack, Handle<Map> feedback);
@@ -20,6 +20,8 @@
 #include "src/objects/smi.h"
 #include "src/objects/tagged.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/swar.h"
+#include "src/strings/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -38,9 +40,21 @@ class JsonStringifier {
                                                       Handle<Object> replacer,
                                                       Handle<Object> gap);
 
+  V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToUtf8(
+      Handle<Object> object, Handle<Object> gap, v8::JSON::Utf8Sink* sink);
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION, NEED_STACK };
 
+  // Serializes |object| into the part buffer, throwing if the result would
+  // be too long.
+  Result SerializeRoot(Handle<Object> object, Handle<Object> replacer,
+                       Handle<Object> gap);
+
+  template <typename Char>
+  static void WriteUtf8(const Char* chars, int length,
+                        v8::JSON::Utf8Sink* sink);
+
   bool InitializeReplacer(Handle<Object> replacer);
   bool InitializeGap(Handle<Object> gap);
 
@@ -86,6 +100,20 @@ class JsonStringifier {
     if V8_UNLIKELY (current_index_ == part_length_) Extend();
   }
 
+  template <typename SrcChar, typename DestChar>
+  V8_INLINE void AppendChars(const SrcChar* chars, int length) {
+    DCHECK_EQ(encoding_ == String::ONE_BYTE_ENCODING, sizeof(DestChar) == 1);
+    while (length > 0) {
+      int chunk_length = std::min(length, part_length_ - current_index_);
+      CopyChars(reinterpret_cast<DestChar*>(part_ptr_) + current_index_, chars,
+                chunk_length);
+      current_index_ += chunk_length;
+      chars += chunk_length;
+      length -= chunk_length;
+      if V8_UNLIKELY (current_index_ == part_length_) Extend();
+    }
+  }
+
   V8_INLINE void AppendCharacter(uint8_t c) {
     if (encoding_ == String::ONE_BYTE_ENCODING) {
       Append<uint8_t, uint8_t>(c);
@@ -253,6 +281,12 @@ class JsonStringifier {
       cursor_ += length;
     }
 
+    template <typename SrcChar>
+    V8_INLINE void AppendChars(const SrcChar* chars, int length) {
+      CopyChars(cursor_, chars, length);
+      cursor_ += length;
+    }
+
    private:
     int* current_index_;
     DestChar* start_;
@@ -342,6 +376,12 @@ class JsonStringifier {
   template <typename Char>
   V8_INLINE static bool DoNotEscape(Char c);
 
+  // Returns the end of the run of characters starting at |start| which don't
+  // need escaping. Whole words of characters are checked at once.
+  template <typename Char>
+  V8_INLINE static const Char* SkipCharsNotNeedingEscape(const Char* start,
+                                                         const Char* end);
+
   V8_INLINE void NewLine();
   V8_NOINLINE void NewLineOutline();
   V8_INLINE void Indent() { indent_++; }
@@ -404,6 +444,12 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+Maybe<bool> JsonStringifyToUtf8(Isolate* isolate, Handle<Object> object,
+                                Handle<Object> gap, v8::JSON::Utf8Sink* sink) {
+  JsonStringifier stringifier(isolate);
+  return stringifier.StringifyToUtf8(object, gap, sink);
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -463,16 +509,15 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
   part_ptr_ = one_byte_ptr_;
 }
 
-MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
-                                               Handle<Object> replacer,
-                                               Handle<Object> gap) {
+JsonStringifier::Result JsonStringifier::SerializeRoot(
+    Handle<Object> object, Handle<Object> replacer, Handle<Object> gap) {
   if (!InitializeReplacer(replacer)) {
     CHECK(isolate_->has_exception());
-    return MaybeHandle<Object>();
+    return EXCEPTION;
   }
   if (!IsUndefined(*gap, isolate_) && !InitializeGap(gap)) {
     CHECK(isolate_->has_exception());
-    return MaybeHandle<Object>();
+    return EXCEPTION;
   }
   Result result = SerializeObject(object);
   if (result == NEED_STACK) {
@@ -480,11 +525,20 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
     current_index_ = 0;
     result = SerializeObject(object);
   }
+  if (result == SUCCESS &&
+      (overflowed_ || current_index_ > String::kMaxLength)) {
+    isolate_->Throw(*factory()->NewInvalidStringLengthError());
+    return EXCEPTION;
+  }
+  return result;
+}
+
+MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
+                                               Handle<Object> replacer,
+                                               Handle<Object> gap) {
+  Result result = SerializeRoot(object, replacer, gap);
   if (result == UNCHANGED) return factory()->undefined_value();
   if (result == SUCCESS) {
-    if (overflowed_ || current_index_ > String::kMaxLength) {
-      THROW_NEW_ERROR(isolate_, NewInvalidStringLengthError(), String);
-    }
     if (encoding_ == String::ONE_BYTE_ENCODING) {
       return isolate_->factory()
           ->NewStringFromOneByte(base::OneByteVector(
@@ -500,6 +554,67 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   return MaybeHandle<Object>();
 }
 
+Maybe<bool> JsonStringifier::StringifyToUtf8(Handle<Object> object,
+                                             Handle<Object> gap,
+                                             v8::JSON::Utf8Sink* sink) {
+  Result result = SerializeRoot(object, factory()->undefined_value(), gap);
+  if (result == EXCEPTION) {
+    CHECK(isolate_->has_exception());
+    return Nothing<bool>();
+  }
+  DCHECK_NE(result, NEED_STACK);
+  if (result == UNCHANGED) return Just(false);
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    WriteUtf8(one_byte_ptr_, current_index_, sink);
+  } else {
+    WriteUtf8(two_byte_ptr_, current_index_, sink);
+  }
+  return Just(true);
+}
+
+template <typename Char>
+void JsonStringifier::WriteUtf8(const Char* chars, int length,
+                                v8::JSON::Utf8Sink* sink) {
+  static constexpr int kBufferSize = 1024;
+  static constexpr int kMaxEncodedSize = unibrow::Utf8::kMaxEncodedSize;
+  static constexpr Char kMaxAscii = unibrow::Utf8::kMaxOneByteChar;
+  char buffer[kBufferSize];
+  int buffer_length = 0;
+  int i = 0;
+  while (i < length) {
+    // Pass runs of ASCII characters of one-byte results on without copying.
+    if constexpr (sizeof(Char) == 1) {
+      int run_end = i;
+      while (run_end < length && chars[run_end] <= kMaxAscii) run_end++;
+      if (run_end > i) {
+        if (buffer_length > 0) {
+          sink->Append(buffer, buffer_length);
+          buffer_length = 0;
+        }
+        sink->Append(reinterpret_cast<const char*>(chars + i), run_end - i);
+        i = run_end;
+        continue;
+      }
+    }
+
+    if (buffer_length > kBufferSize - kMaxEncodedSize) {
+      sink->Append(buffer, buffer_length);
+      buffer_length = 0;
+    }
+    base::uc32 c = chars[i++];
+    // Lone surrogates are escaped by the serializer, so any surrogate left
+    // in the output is part of a pair.
+    if (unibrow::Utf16::IsLeadSurrogate(c) && i < length &&
+        unibrow::Utf16::IsTrailSurrogate(chars[i])) {
+      c = unibrow::Utf16::CombineSurrogatePair(c, chars[i++]);
+    }
+    buffer_length += unibrow::Utf8::Encode(buffer + buffer_length, c,
+                                           unibrow::Utf16::kNoPreviousCharacter,
+                                           true);
+  }
+  if (buffer_length > 0) sink->Append(buffer, buffer_length);
+}
+
 bool JsonStringifier::InitializeReplacer(Handle<Object> replacer) {
   DCHECK(property_list_.is_null());
   DCHECK(replacer_function_.is_null());
@@ -1367,20 +1482,65 @@ JsonStringifier::Result JsonStringifier::SerializeJSProxy(
   return SUCCESS;
 }
 
+namespace {
+
+// Returns true if the word contains a character that DoNotEscape rejects:
+// '"', '\\', a control character, or (for two-byte strings) a surrogate.
+template <typename Char>
+constexpr bool WordNeedsEscaping(uint64_t word) {
+  if (HasLaneLessThan<Char>(word, 0x20) || HasLaneEqualTo<Char>(word, '"') ||
+      HasLaneEqualTo<Char>(word, '\\')) {
+    return true;
+  }
+  if constexpr (sizeof(Char) == 2) {
+    return HasLaneEqualTo<Char>(word & (kLaneOnes<Char> * 0xF800), 0xD800);
+  }
+  return false;
+}
+
+}  // namespace
+
+template <typename Char>
+const Char* JsonStringifier::SkipCharsNotNeedingEscape(const Char* start,
+                                                       const Char* end) {
+  const Char* cursor = start;
+  while (true) {
+    while (end - cursor >= kCharsPerWord<Char> &&
+           !WordNeedsEscaping<Char>(ReadCharsWord(cursor))) {
+      cursor += kCharsPerWord<Char>;
+    }
+    // The next word, if any, has a character that needs escaping. Find it.
+    if (cursor == end || !DoNotEscape(*cursor)) return cursor;
+    cursor++;
+  }
+}
+
 template <typename SrcChar, typename DestChar, bool raw_json>
 bool JsonStringifier::SerializeStringUnchecked_(
     base::Vector<const SrcChar> src, NoExtendBuilder<DestChar>* dest) {
   // Assert that base::uc16 character is not truncated down to 8 bit.
   // The <base::uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
+  if (raw_json) {
+    dest->AppendChars(src.begin(), src.length());
+    return false;
+  }
   bool required_escaping = false;
   for (int i = 0; i < src.length(); i++) {
+    // Copy the run of characters that don't need escaping in one go.
+    const SrcChar* run_end =
+        SkipCharsNotNeedingEscape(src.begin() + i, src.end());
+    int run_length = static_cast<int>(run_end - (src.begin() + i));
+    if (run_length > 0) {
+      dest->AppendChars(src.begin() + i, run_length);
+      i += run_length;
+      if (i == src.length()) break;
+    }
     SrcChar c = src[i];
-    if (raw_json || DoNotEscape(c)) {
-      dest->Append(c);
-    } else if (sizeof(SrcChar) != 1 &&
-               base::IsInRange(c, static_cast<SrcChar>(0xD800),
-                               static_cast<SrcChar>(0xDFFF))) {
+    DCHECK(!DoNotEscape(c));
+    if (sizeof(SrcChar) != 1 &&
+        base::IsInRange(c, static_cast<SrcChar>(0xD800),
+                        static_cast<SrcChar>(0xDFFF))) {
       // The current character is a surrogate.
       required_escaping = true;
       if (c <= 0xDBFF) {
@@ -1445,14 +1605,23 @@ bool JsonStringifier::SerializeString_(Tagged<String> string,
         &current_index_);
     required_escaping = SerializeStringUnchecked_<SrcChar, DestChar, raw_json>(
         vector, &no_extend);
+  } else if (raw_json) {
+    AppendChars<SrcChar, DestChar>(vector.begin(), vector.length());
   } else {
     for (int i = 0; i < vector.length(); i++) {
+      const SrcChar* run_end =
+          SkipCharsNotNeedingEscape(vector.begin() + i, vector.end());
+      int run_length = static_cast<int>(run_end - (vector.begin() + i));
+      if (run_length > 0) {
+        AppendChars<SrcChar, DestChar>(vector.begin() + i, run_length);
+        i += run_length;
+        if (i == vector.length()) break;
+      }
       SrcChar c = vector.at(i);
-      if (raw_json || DoNotEscape(c)) {
-        Append<SrcChar, DestChar>(c);
-      } else if (sizeof(SrcChar) != 1 &&
-                 base::IsInRange(c, static_cast<SrcChar>(0xD800),
-                                 static_cast<SrcChar>(0xDFFF))) {
+      DCHECK(!DoNotEscape(c));
+      if (sizeof(SrcChar) != 1 &&
+          base::IsInRange(c, static_cast<SrcChar>(0xD800),
+                          static_cast<SrcChar>(0xDFFF))) {
         // The current character is a surrogate.
         required_escaping = true;
         if (c <= 0xDBFF) {
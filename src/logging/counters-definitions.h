@@ -360,6 +360,8 @@ namespace internal {
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(maps_created, V8.MapsCreated)                                             \
+  /* Number of transition tree lookups made while building JSON objects. */    \
+  SC(json_parse_transition_lookups, V8.JsonParseTransitionLookups)             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
   SC(stack_interrupts, V8.StackInterrupts)                                     \
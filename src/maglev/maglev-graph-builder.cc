@@ -7684,6 +7684,46 @@ ReduceResult MaglevGraphBuilder::ReduceCallForNewClosure(
   return BuildGenericCall(target_node, Call::TargetType::kJSFunction, args);
 }
 
+ReduceResult MaglevGraphBuilder::ReduceCallForFeedbackCell(
+    ValueNode* target_node, compiler::FeedbackCellRef feedback_cell,
+    CallArguments& args, const compiler::FeedbackSource& feedback_source,
+    SpeculationMode speculation_mode) {
+  if (!v8_flags.maglev_feedback_cell_calls) return ReduceResult::Fail();
+  // ReduceCallForNewClosure can't reduce spread calls, so don't emit checks.
+  if (args.mode() != CallArguments::kDefault) return ReduceResult::Fail();
+  // Known targets (constants and freshly created closures) are handled more
+  // precisely by ReduceCall.
+  if (TryGetConstant(target_node).has_value() ||
+      target_node->Is<FastCreateClosure>() ||
+      target_node->Is<CreateClosure>()) {
+    return ReduceResult::Fail();
+  }
+  compiler::OptionalFeedbackVectorRef feedback_vector =
+      feedback_cell.feedback_vector(broker());
+  compiler::OptionalSharedFunctionInfoRef shared =
+      feedback_cell.shared_function_info(broker());
+  if (!feedback_vector.has_value() || !shared.has_value()) {
+    return ReduceResult::Fail();
+  }
+
+  // Check that {target_node} is a closure with the given {feedback_cell},
+  // which uniquely identifies a given function inside a native context. This
+  // covers call sites that see many closures of the same function, e.g.
+  // callbacks created per instance.
+  NodeType known_type;
+  EnsureType(target_node, NodeType::kCallable, &known_type);
+  AddNewNode<CheckInstanceType>({target_node}, GetCheckType(known_type),
+                                FIRST_JS_FUNCTION_TYPE, LAST_JS_FUNCTION_TYPE);
+  ValueNode* target_feedback_cell = AddNewNode<LoadTaggedField>(
+      {target_node}, JSFunction::kFeedbackCellOffset);
+  RETURN_IF_ABORT(BuildCheckValue(target_feedback_cell, feedback_cell));
+  ValueNode* target_context =
+      AddNewNode<LoadTaggedField>({target_node}, JSFunction::kContextOffset);
+  return ReduceCallForNewClosure(target_node, target_context, shared.value(),
+                                 feedback_vector, args, feedback_source,
+                                 speculation_mode);
+}
+
 ReduceResult MaglevGraphBuilder::ReduceFunctionPrototypeApplyCallWithReceiver(
     ValueNode* target_node, compiler::JSFunctionRef receiver,
     CallArguments& args, const compiler::FeedbackSource& feedback_source,
@@ -7750,6 +7790,14 @@ void MaglevGraphBuilder::BuildCallWithFeedback(
       DCHECK_EQ(CallFeedbackContent::kTarget, content);
     }
     RETURN_VOID_IF_ABORT(BuildCheckValue(target_node, feedback_target));
+  } else if (call_feedback.target().has_value() &&
+             call_feedback.target()->IsFeedbackCell()) {
+    PROCESS_AND_RETURN_IF_DONE(
+        ReduceCallForFeedbackCell(target_node,
+                                  call_feedback.target()->AsFeedbackCell(),
+                                  args, feedback_source,
+                                  call_feedback.speculation_mode()),
+        SetAccumulator);
   }
 
   PROCESS_AND_RETURN_IF_DONE(ReduceCall(target_node, args, feedback_source,
@@ -504,7 +504,12 @@ class MaglevGraphBuilder {
   bool ShouldEmitOsrInterruptBudgetChecks() {
     if (!v8_flags.turbofan || !v8_flags.use_osr || !v8_flags.osr_from_maglev)
       return false;
-    if (!graph_->is_osr() && !v8_flags.always_osr_from_maglev) return false;
+    if (!graph_->is_osr() && !v8_flags.always_osr_from_maglev) {
+      // Loops of the function itself can still be hot enough to be worth
+      // OSR'ing once the function has been compiled by Turbofan (see
+      // TieringManager::MaybeOptimizeFrame).
+      if (!v8_flags.maglev_osr_from_hot_loops || is_inline()) return false;
+    }
     // TODO(olivf) OSR from maglev requires lazy recompilation (see
     // CompileOptimizedOSRFromMaglev for details). Without this we end up in
     // deopt loops, e.g., in chromium content_unittests.
@@ -1870,6 +1875,10 @@ class MaglevGraphBuilder {
       compiler::OptionalFeedbackVectorRef feedback_vector, CallArguments& args,
       const compiler::FeedbackSource& feedback_source,
       SpeculationMode speculation_mode);
+  ReduceResult ReduceCallForFeedbackCell(
+      ValueNode* target_node, compiler::FeedbackCellRef feedback_cell,
+      CallArguments& args, const compiler::FeedbackSource& feedback_source,
+      SpeculationMode speculation_mode);
   ReduceResult TryBuildCallKnownApiFunction(
       compiler::JSFunctionRef function, compiler::SharedFunctionInfoRef shared,
       CallArguments& args);
@@ -686,6 +686,36 @@ bool FeedbackNexus::ConfigureMegamorphic() {
   return false;
 }
 
+bool FeedbackNexus::Despeculate() {
+  DisallowGarbageCollection no_gc;
+  if (IsLoadICKind(kind())) return ConfigureMegamorphic();
+  if (IsKeyedLoadICKind(kind())) {
+    // Megamorphic keyed feedback records whether the keys were names.
+    return ConfigureMegamorphic(GetKeyType());
+  }
+  if (kind() == FeedbackSlotKind::kBinaryOp ||
+      kind() == FeedbackSlotKind::kCompareOp) {
+    // Move up the feedback lattice by one step: Smi-only feedback becomes
+    // Number feedback, anything else becomes Any.
+    int feedback = GetFeedback().ToSmi().value();
+    int widened;
+    if (kind() == FeedbackSlotKind::kBinaryOp) {
+      widened = (feedback & ~BinaryOperationFeedback::kSignedSmallInputs) == 0
+                    ? BinaryOperationFeedback::kNumber
+                    : BinaryOperationFeedback::kAny;
+    } else {
+      widened = (feedback & ~CompareOperationFeedback::kSignedSmall) == 0
+                    ? CompareOperationFeedback::kNumber
+                    : CompareOperationFeedback::kAny;
+    }
+    widened |= feedback;
+    if (widened == feedback) return false;
+    SetFeedback(Smi::FromInt(widened), SKIP_WRITE_BARRIER);
+    return true;
+  }
+  return false;
+}
+
 void FeedbackNexus::ConfigureMegaDOM(const MaybeObjectHandle& handler) {
   DisallowGarbageCollection no_gc;
   Tagged<MaybeObject> sentinel = MegaDOMSentinel();
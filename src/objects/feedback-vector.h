@@ -847,6 +847,10 @@ class V8_EXPORT_PRIVATE FeedbackNexus final {
   // was changed. Extra feedback is cleared if the 0 parameter version is used.
   bool ConfigureMegamorphic();
   bool ConfigureMegamorphic(IcCheckType property_type);
+  // Widens the feedback so that optimizing compilers stop relying on the
+  // assumption it currently encodes, e.g. Smi-only arithmetic or a fixed set
+  // of maps. Returns true if the state of the underlying vector was changed.
+  bool Despeculate();
 
   inline Tagged<MaybeObject> GetFeedback() const;
   inline Tagged<MaybeObject> GetFeedbackExtra() const;
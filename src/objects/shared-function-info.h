@@ -535,6 +535,10 @@ class SharedFunctionInfo
 
   DECL_BOOLEAN_ACCESSORS(sparkplug_compiled)
 
+  // Set for functions that were lazily compiled during the startup window of
+  // --code-cache-startup-profile. Serialized with the code cache.
+  DECL_BOOLEAN_ACCESSORS(compiled_during_startup)
+
   CachedTieringDecision cached_tiering_decision();
   void set_cached_tiering_decision(CachedTieringDecision decision);
 
@@ -27,7 +27,9 @@ UnoptimizedCompileFlags::UnoptimizedCompileFlags(Isolate* isolate,
       script_id_(script_id),
       function_kind_(FunctionKind::kNormalFunction),
       function_syntax_kind_(FunctionSyntaxKind::kDeclaration),
-      parsing_while_debugging_(ParsingWhileDebugging::kNo) {
+      parsing_while_debugging_(ParsingWhileDebugging::kNo),
+      parallel_compile_tasks_min_function_size_(
+          v8_flags.parallel_compile_tasks_min_function_size) {
   set_coverage_enabled(!isolate->is_best_effort_code_coverage());
   set_block_coverage_enabled(isolate->is_block_code_coverage());
   set_might_always_turbofan(v8_flags.always_turbofan ||
@@ -40,6 +42,8 @@ UnoptimizedCompileFlags::UnoptimizedCompileFlags(Isolate* isolate,
       v8_flags.parallel_compile_tasks_for_eager_toplevel);
   set_post_parallel_compile_tasks_for_lazy(
       v8_flags.parallel_compile_tasks_for_lazy);
+  set_post_parallel_compile_tasks_for_likely_called(
+      v8_flags.parallel_compile_tasks_for_likely_called);
 }
 
 // static
@@ -61,6 +61,7 @@ class Zone;
   V(allow_lazy_compile, bool, 1, _)                             \
   V(post_parallel_compile_tasks_for_eager_toplevel, bool, 1, _) \
   V(post_parallel_compile_tasks_for_lazy, bool, 1, _)           \
+  V(post_parallel_compile_tasks_for_likely_called, bool, 1, _)  \
   V(collect_source_positions, bool, 1, _)                       \
   V(is_repl_mode, bool, 1, _)                                   \
   V(produce_compile_hints, bool, 1, _)                          \
@@ -131,6 +132,15 @@ class V8_EXPORT_PRIVATE UnoptimizedCompileFlags {
     return *this;
   }
 
+  int parallel_compile_tasks_min_function_size() const {
+    return parallel_compile_tasks_min_function_size_;
+  }
+  UnoptimizedCompileFlags& set_parallel_compile_tasks_min_function_size(
+      int value) {
+    parallel_compile_tasks_min_function_size_ = value;
+    return *this;
+  }
+
  private:
   struct BitFields {
     DEFINE_BIT_FIELDS(FLAG_FIELDS)
@@ -153,6 +163,7 @@ class V8_EXPORT_PRIVATE UnoptimizedCompileFlags {
   FunctionKind function_kind_;
   FunctionSyntaxKind function_syntax_kind_;
   ParsingWhileDebugging parsing_while_debugging_;
+  int parallel_compile_tasks_min_function_size_;
 };
 
 #undef FLAG_FIELDS
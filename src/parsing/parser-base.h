@@ -3759,6 +3759,7 @@ ParserBase<Impl>::ParseLeftHandSideContinuation(ExpressionT result) {
         // they are actually direct calls to eval is determined at run time.
         Call::PossiblyEval is_possibly_eval =
             CheckPossibleEvalCall(result, is_optional, scope());
+        impl()->RecordTopLevelCall(result);
 
         result = factory()->NewCall(result, args, pos, has_spread,
                                     is_possibly_eval, is_optional);
@@ -608,6 +608,30 @@ void Parser::ParseProgram(Isolate* isolate, Handle<Script> script,
   }
 }
 
+void Parser::PostParallelCompileTasksForLikelyCalledFunctions(
+    DeclarationScope* scope) {
+  if (top_level_callees_ == nullptr || has_error()) return;
+  // The same preconditions as for the other parallel compile tasks posted in
+  // ParseFunctionLiteral apply.
+  if (!info()->dispatcher() || flags().is_reparse() ||
+      !scanner()->stream()->can_be_cloned_for_parallel_access()) {
+    return;
+  }
+  for (Declaration* decl : *scope->declarations()) {
+    if (!decl->IsFunctionDeclaration()) continue;
+    FunctionLiteral* literal = decl->AsFunctionDeclaration()->fun();
+    // Only functions that were preparsed still need to be compiled; eager
+    // ones are compiled together with the top-level code.
+    if (!literal->scope()->was_lazily_parsed()) continue;
+    if (literal->end_position() - literal->start_position() <
+        v8_flags.parallel_compile_tasks_min_function_size) {
+      continue;
+    }
+    if (top_level_callees_->count(decl->var()->raw_name()) == 0) continue;
+    literal->set_should_parallel_compile();
+  }
+}
+
 FunctionLiteral* Parser::DoParseProgram(Isolate* isolate, ParseInfo* info) {
   // Note that this function can be called from the main thread or from a
   // background thread. We should not access anything Isolate / heap dependent
@@ -705,6 +729,7 @@ FunctionLiteral* Parser::DoParseProgram(Isolate* isolate, ParseInfo* info) {
       info->ast_value_factory()->Internalize(isolate);
     }
     CheckConflictingVarDeclarations(scope);
+    PostParallelCompileTasksForLikelyCalledFunctions(scope);
 
     if (flags().parse_restriction() == ONLY_SINGLE_FUNCTION_LITERAL) {
       if (body.length() != 1 || !body.at(0)->IsExpressionStatement() ||
@@ -2856,6 +2881,17 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 
   RecordFunctionLiteralSourceRange(function_literal);
 
+  // The cost of cloning the stream and posting a task outweighs parsing small
+  // functions in parallel, so leave those to be compiled lazily instead. This
+  // only applies to lazy functions, which are preparsed either way. An eager
+  // function has already been preparsed only because of the task, and would
+  // otherwise be parsed again on the main thread when it is first called.
+  if (should_post_parallel_task && is_lazy &&
+      scope->end_position() - scope->start_position() <
+          flags().parallel_compile_tasks_min_function_size()) {
+    should_post_parallel_task = false;
+  }
+
   if (should_post_parallel_task && !has_error()) {
     function_literal->set_should_parallel_compile();
   }
@@ -22,6 +22,7 @@
 #include "src/parsing/parsing.h"
 #include "src/parsing/preparser.h"
 #include "src/zone/zone-chunk-list.h"
+#include "src/zone/zone-containers.h"
 
 namespace v8 {
 
@@ -1101,6 +1102,28 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
     return current_compile_hint;
   }
 
+  // Remembers the names of functions called directly from top-level code, so
+  // that lazy function declarations with those names can be compiled on a
+  // background thread before their first call.
+  V8_INLINE void RecordTopLevelCall(Expression* callee) {
+    if (V8_LIKELY(!flags().post_parallel_compile_tasks_for_likely_called())) {
+      return;
+    }
+    if (!callee->IsVariableProxy()) return;
+    DeclarationScope* closure_scope = scope()->GetClosureScope();
+    if (!closure_scope->is_script_scope() &&
+        !closure_scope->is_module_scope()) {
+      return;
+    }
+    if (top_level_callees_ == nullptr) {
+      top_level_callees_ =
+          zone()->New<ZoneUnorderedSet<const AstRawString*>>(zone());
+    }
+    top_level_callees_->insert(callee->AsVariableProxy()->raw_name());
+  }
+  void PostParallelCompileTasksForLikelyCalledFunctions(
+      DeclarationScope* scope);
+
   // Generate the next internal variable name for binding an exported namespace
   // object (used to implement the "export * as" syntax).
   const AstRawString* NextInternalNamespaceExportName();
@@ -1149,6 +1172,10 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
   // indicates the correct position of the ')' that closes the parameter list.
   // After that ')' is encountered, this field is reset to kNoSourcePosition.
   int parameters_end_pos_;
+
+  // Names of the functions called from top-level code, see
+  // RecordTopLevelCall().
+  ZoneUnorderedSet<const AstRawString*>* top_level_callees_ = nullptr;
 };
 
 }  // namespace internal
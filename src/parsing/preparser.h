@@ -1668,6 +1668,8 @@ class PreParser : public ParserBase<PreParser> {
     return current_compile_hint;
   }
 
+  V8_INLINE void RecordTopLevelCall(const PreParserExpression& callee) {}
+
 // Generate empty functions here as the preparser does not collect source
 // ranges for block coverage.
 #define DEFINE_RECORD_SOURCE_RANGE(Name) \
@@ -19,6 +19,7 @@
 #include "src/parsing/token.h"
 #include "src/regexp/regexp-flags.h"
 #include "src/strings/char-predicates.h"
+#include "src/strings/swar.h"
 #include "src/strings/unicode.h"
 #include "src/utils/allocation.h"
 
@@ -95,6 +96,41 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil, but skips over runs of ASCII code units that are not
+  // one of kStops a word at a time. |check| must return true for every
+  // code unit in kStops and false for every other ASCII code unit; non-ASCII
+  // code units are always passed to |check|.
+  template <uint16_t... kStops, typename FunctionType>
+  V8_INLINE base::uc32 AdvanceUntilWordwise(FunctionType check) {
+    while (true) {
+      const uint16_t* cursor = buffer_cursor_;
+      while (true) {
+        while (buffer_end_ - cursor >= kCharsPerWord<uint16_t> &&
+               !WordMayContain<kStops...>(ReadCharsWord(cursor))) {
+          cursor += kCharsPerWord<uint16_t>;
+        }
+        const uint16_t* word_end =
+            buffer_end_ - cursor > kCharsPerWord<uint16_t>
+                ? cursor + kCharsPerWord<uint16_t>
+                : buffer_end_;
+        for (; cursor < word_end; cursor++) {
+          base::uc32 c0 = static_cast<base::uc32>(*cursor);
+          if (check(c0)) {
+            buffer_cursor_ = cursor + 1;
+            return c0;
+          }
+        }
+        if (cursor == buffer_end_) break;
+      }
+
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlockChecked(pos())) {
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -152,6 +188,16 @@ class Utf16CharacterStream {
         buffer_pos_(buffer_pos) {}
   Utf16CharacterStream() : Utf16CharacterStream(nullptr, nullptr, nullptr, 0) {}
 
+  // Returns true if any of the four code units packed into |word| is either
+  // non-ASCII or one of kStops. False positives are harmless; the caller
+  // re-checks each code unit of the word.
+  template <uint16_t... kStops>
+  static constexpr bool WordMayContain(uint64_t word) {
+    static_assert(((kStops <= 0x7F) && ...));
+    if (word & (kLaneOnes<uint16_t> * 0xFF80)) return true;
+    return (HasLaneEqualTo<uint16_t>(word, kStops) || ...);
+  }
+
   bool ReadBlockChecked(size_t position) {
     // The callers of this method (Back/Back2/Seek) should handle the easy
     // case (seeking within the current buffer), and we should only get here
@@ -549,6 +595,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <uint16_t... kStops, typename FunctionType>
+  V8_INLINE void AdvanceUntilWordwise(FunctionType check) {
+    c0_ = source_->AdvanceUntilWordwise<kStops...>(check);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
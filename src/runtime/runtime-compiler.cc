@@ -362,6 +362,10 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
 
   // Make sure to materialize objects before causing any allocation.
   deoptimizer->MaterializeHeapObjects();
+  if (deopt_kind == DeoptimizeKind::kEager &&
+      !IsDeoptimizationWithoutCodeInvalidation(deopt_reason)) {
+    deoptimizer->RecordDeoptimizationStats();
+  }
   const BytecodeOffset deopt_exit_offset =
       deoptimizer->bytecode_offset_in_outermost_frame();
   delete deoptimizer;
@@ -12,6 +12,7 @@
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/codegen/background-merge-task.h"
 #include "src/common/globals.h"
+#include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/handles/maybe-handles.h"
 #include "src/handles/persistent-handles.h"
 #include "src/heap/heap-inl.h"
@@ -23,6 +24,7 @@
 #include "src/objects/shared-function-info.h"
 #include "src/objects/slots.h"
 #include "src/objects/visitors.h"
+#include "src/parsing/scanner-character-streams.h"
 #include "src/snapshot/object-deserializer.h"
 #include "src/snapshot/snapshot-utils.h"
 #include "src/snapshot/snapshot.h"
@@ -397,12 +399,75 @@ void BaselineBatchCompileIfSparkplugCompiled(Isolate* isolate,
         isolate->baseline_batch_compiler()->EnqueueSFI(info);
       }
     }
+    // Functions that were compiled on load when the cache was produced are
+    // expected to run in Sparkplug code right away, so don't wait for the
+    // batch to fill up.
+    if (v8_flags.sparkplug_on_load) {
+      isolate->baseline_batch_compiler()->CompilePendingBatchConcurrent();
+    }
   }
 }
 #else
 void BaselineBatchCompileIfSparkplugCompiled(Isolate*, Tagged<Script>) {}
 #endif  // V8_ENABLE_SPARKPLUG
 
+// Functions that ran during startup when the cache was produced, but whose
+// bytecode had already been flushed by then, are compiled on background
+// threads right away so that startup doesn't stall on them again.
+void CompileStartupFunctionsInParallel(Isolate* isolate,
+                                       Handle<Script> script) {
+  if (!v8_flags.code_cache_startup_profile) return;
+  LazyCompileDispatcher* dispatcher = isolate->lazy_compile_dispatcher();
+  if (dispatcher == nullptr) return;
+
+  Handle<String> source(String::cast(script->source()), isolate);
+  std::unique_ptr<Utf16CharacterStream> stream(
+      ScannerStream::For(isolate, source));
+  // Background tasks can't parse sources that live on the V8 heap.
+  if (!stream->can_be_cloned_for_parallel_access()) return;
+
+  std::vector<Handle<SharedFunctionInfo>> stale_functions;
+  {
+    DisallowGarbageCollection no_gc;
+    SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+    for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      if (info->compiled_during_startup() && !info->is_compiled()) {
+        stale_functions.push_back(handle(info, isolate));
+      }
+    }
+  }
+  for (Handle<SharedFunctionInfo> shared_info : stale_functions) {
+    if (dispatcher->IsEnqueued(shared_info)) continue;
+    dispatcher->Enqueue(isolate->main_thread_local_isolate(), shared_info,
+                        stream->Clone());
+  }
+}
+
+// Bytecode from the code cache is deserialized for every function that was
+// compiled when the cache was produced, whether or not it runs in this
+// process. Start it out one step short of old, so that bytecode flushing
+// reclaims the functions that aren't called before the next full GC. The
+// toplevel function runs right away anyway, and functions recorded by
+// --code-cache-startup-profile are expected to run soon.
+void AgeDeserializedBytecode(Isolate* isolate, Tagged<Script> script) {
+  if (!v8_flags.code_cache_age_deserialized_bytecode ||
+      !v8_flags.flush_bytecode || v8_flags.flush_code_based_on_time ||
+      v8_flags.flush_code_based_on_tab_visibility) {
+    return;
+  }
+  DCHECK_GT(v8_flags.bytecode_old_age, 0);
+  SharedFunctionInfo::ScriptIterator iter(isolate, script);
+  for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (info->is_toplevel() || !info->HasBytecodeArray() ||
+        info->compiled_during_startup()) {
+      continue;
+    }
+    info->set_age(v8_flags.bytecode_old_age - 1);
+  }
+}
+
 const char* ToString(SerializedCodeSanityCheckResult result) {
   switch (result) {
     case SerializedCodeSanityCheckResult::kSuccess:
@@ -491,6 +556,8 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
   Tagged<Script> script = Script::cast(result->script());
   script->set_deserialized(true);
   BaselineBatchCompileIfSparkplugCompiled(isolate, script);
+  AgeDeserializedBytecode(isolate, script);
+  CompileStartupFunctionsInParallel(isolate, handle(script, isolate));
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
     int length = cached_data->length();
@@ -627,6 +694,8 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
     for (Handle<Script> script : data.scripts) {
       script->set_deserialized(true);
       BaselineBatchCompileIfSparkplugCompiled(isolate, *script);
+      AgeDeserializedBytecode(isolate, *script);
+      CompileStartupFunctionsInParallel(isolate, script);
       DCHECK(data.persistent_handles->Contains(script.location()));
       list = WeakArrayList::AddToEnd(isolate, list,
                                      MaybeObjectHandle::Weak(script));
@@ -7,6 +7,8 @@
 #include "src/snapshot/snapshot.h"
 
 #include "src/api/api-inl.h"  // For OpenHandle.
+#include "src/base/optional.h"
+#include "src/base/platform/semaphore.h"
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/common/assert-scope.h"
 #include "src/execution/local-isolate-inl.h"
@@ -15,6 +17,7 @@
 #include "src/heap/read-only-promotion.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/v8.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/js-regexp-inl.h"
@@ -24,6 +27,8 @@
 #include "src/snapshot/shared-heap-serializer.h"
 #include "src/snapshot/snapshot-utils.h"
 #include "src/snapshot/startup-serializer.h"
+#include "src/tasks/cancelable-task.h"
+#include "src/tasks/task-utils.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/version.h"
 
@@ -189,6 +194,48 @@ bool Snapshot::Initialize(Isolate* isolate) {
   base::Vector<const uint8_t> shared_heap_data =
       SnapshotImpl::ExtractSharedHeapData(blob);
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+  if (v8_flags.parallel_snapshot_decompression) {
+    // The startup blob is by far the largest, so inflate it on a worker thread
+    // while the main thread inflates the read-only and shared heap blobs.
+    // Decompression only reads the embedded blob and writes a fresh buffer.
+    base::Optional<SnapshotData> startup_snapshot_data;
+    base::Optional<SnapshotData> read_only_snapshot_data;
+    base::Optional<SnapshotData> shared_heap_snapshot_data;
+    {
+      TRACE_EVENT0("v8", "V8.SnapshotDecompress");
+      RCS_SCOPE(isolate, RuntimeCallCounterId::kSnapshotDecompress);
+      NestedTimedHistogramScope histogram_timer(
+          isolate->counters()->snapshot_decompress());
+      base::Semaphore startup_decompressed(0);
+      std::unique_ptr<CancelableTask> task =
+          MakeCancelableTask(isolate, [&startup_snapshot_data, startup_data,
+                                       &startup_decompressed] {
+            startup_snapshot_data.emplace(
+                SnapshotCompression::Decompress(startup_data));
+            startup_decompressed.Signal();
+          });
+      const CancelableTaskManager::Id task_id = task->id();
+      V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+      read_only_snapshot_data.emplace(
+          SnapshotCompression::Decompress(read_only_data));
+      shared_heap_snapshot_data.emplace(
+          SnapshotCompression::Decompress(shared_heap_data));
+      // If no worker picked up the task yet, don't wait for one.
+      if (isolate->cancelable_task_manager()->TryAbort(task_id) ==
+          TryAbortResult::kTaskAborted) {
+        startup_snapshot_data.emplace(
+            SnapshotCompression::Decompress(startup_data));
+      } else {
+        startup_decompressed.Wait();
+      }
+    }
+    return isolate->InitWithSnapshot(
+        &startup_snapshot_data.value(), &read_only_snapshot_data.value(),
+        &shared_heap_snapshot_data.value(), ExtractRehashability(blob));
+  }
+#endif  // V8_SNAPSHOT_COMPRESSION
+
   SnapshotData startup_snapshot_data(MaybeDecompress(isolate, startup_data));
   SnapshotData read_only_snapshot_data(
       MaybeDecompress(isolate, read_only_data));
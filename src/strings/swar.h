@@ -0,0 +1,53 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_STRINGS_SWAR_H_
+#define V8_STRINGS_SWAR_H_
+
+#include <cstdint>
+
+#include "src/base/memory.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Helpers for scanning strings a uint64_t word of Chars at a time ("SIMD
+// within a register"). Each Char occupies one lane of the word; the lane order
+// doesn't matter for any of the tests below, so words can be read from
+// unaligned character data in native byte order.
+
+template <typename Char>
+constexpr int kCharsPerWord = sizeof(uint64_t) / sizeof(Char);
+
+template <typename Char>
+constexpr uint64_t kLaneOnes = sizeof(Char) == 1 ? 0x0101'0101'0101'0101
+                                                 : 0x0001'0001'0001'0001;
+
+template <typename Char>
+constexpr uint64_t kLaneHighBits = kLaneOnes<Char>
+                                   << (kBitsPerByte * sizeof(Char) - 1);
+
+// Returns true if any lane of |word| is less than |n|, for n <= 0x80.
+template <typename Char>
+constexpr bool HasLaneLessThan(uint64_t word, uint8_t n) {
+  return ((word - kLaneOnes<Char> * n) & ~word & kLaneHighBits<Char>) != 0;
+}
+
+// Returns true if any lane of |word| is equal to |c|.
+template <typename Char>
+constexpr bool HasLaneEqualTo(uint64_t word, Char c) {
+  return HasLaneLessThan<Char>(word ^ (kLaneOnes<Char> * c), 1);
+}
+
+// Reads the kCharsPerWord<Char> characters starting at |cursor| as one word.
+template <typename Char>
+V8_INLINE uint64_t ReadCharsWord(const Char* cursor) {
+  return base::ReadUnalignedValue<uint64_t>(reinterpret_cast<Address>(cursor));
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_STRINGS_SWAR_H_
@@ -9,6 +9,9 @@
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -65,6 +68,123 @@ std::unique_ptr<v8::base::BoundedPageAllocator> CreateBoundedAllocator(
 
 }  // namespace
 
+// The segment pool keeps returned segments in size classes (the power of two
+// segment sizes used by zones) so that they can be handed out again without
+// going through malloc. To avoid contention between compiler threads, the
+// pool is split into shards selected by the id of the current thread. The
+// total amount of pooled memory is bounded by --zone-segment-pool-size;
+// segments returned beyond that high-water mark are freed.
+class AccountingAllocator::SegmentPool final {
+ public:
+  explicit SegmentPool(size_t capacity)
+      : shard_capacity_(capacity / kNumberOfShards) {}
+  SegmentPool(const SegmentPool&) = delete;
+  SegmentPool& operator=(const SegmentPool&) = delete;
+  ~SegmentPool() { ReleaseAll(); }
+
+  // Returns the memory of a pooled segment of at least {bytes} bytes and
+  // stores its size in {size}, or nullptr if there is none.
+  void* TryGet(size_t bytes, size_t* size) {
+    int size_class = SizeClassForAllocation(bytes);
+    if (size_class < 0) return nullptr;
+    Shard& shard = CurrentShard();
+    base::MutexGuard guard(&shard.mutex);
+    FreeEntry* entry = shard.free_lists[size_class];
+    if (entry == nullptr) return nullptr;
+    shard.free_lists[size_class] = entry->next;
+    shard.pooled_bytes -= entry->size;
+    pooled_bytes_.fetch_sub(entry->size, std::memory_order_relaxed);
+    *size = entry->size;
+    return entry;
+  }
+
+  // Keeps the memory of a segment of {size} bytes for reuse. Returns false if
+  // the segment should be freed instead.
+  bool TryPut(void* memory, size_t size) {
+    int size_class = SizeClassForRelease(size);
+    if (size_class < 0) return false;
+    Shard& shard = CurrentShard();
+    base::MutexGuard guard(&shard.mutex);
+    if (shard.pooled_bytes + size > shard_capacity_) return false;
+    FreeEntry* entry =
+        new (memory) FreeEntry{shard.free_lists[size_class], size};
+    shard.free_lists[size_class] = entry;
+    shard.pooled_bytes += size;
+    pooled_bytes_.fetch_add(size, std::memory_order_relaxed);
+    return true;
+  }
+
+  void ReleaseAll() {
+    for (Shard& shard : shards_) {
+      base::MutexGuard guard(&shard.mutex);
+      for (FreeEntry*& list : shard.free_lists) {
+        while (list != nullptr) {
+          FreeEntry* next = list->next;
+          pooled_bytes_.fetch_sub(list->size, std::memory_order_relaxed);
+          free(list);
+          list = next;
+        }
+      }
+      shard.pooled_bytes = 0;
+    }
+  }
+
+  size_t pooled_bytes() const {
+    return pooled_bytes_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr int kNumberOfShards = 8;
+  // Size classes go from the minimum (8 KB) to the maximum (32 KB) segment
+  // size that zones request.
+  static constexpr size_t kSmallestSizeClass = 8 * KB;
+  static constexpr int kNumberOfSizeClasses = 3;
+
+  struct FreeEntry {
+    FreeEntry* next;
+    size_t size;
+  };
+
+  struct Shard {
+    base::Mutex mutex;
+    FreeEntry* free_lists[kNumberOfSizeClasses] = {};
+    size_t pooled_bytes = 0;
+  };
+
+  static size_t SizeOfClass(int size_class) {
+    return kSmallestSizeClass << size_class;
+  }
+
+  // Smallest size class whose segments can hold {bytes}.
+  static int SizeClassForAllocation(size_t bytes) {
+    for (int i = 0; i < kNumberOfSizeClasses; i++) {
+      if (bytes <= SizeOfClass(i)) return i;
+    }
+    return -1;
+  }
+
+  // Largest size class that a segment of {size} bytes can serve. Segments
+  // may be slightly larger than requested (see AllocAtLeastWithRetry), but
+  // much larger ones are not worth keeping around.
+  static int SizeClassForRelease(size_t size) {
+    for (int i = kNumberOfSizeClasses - 1; i >= 0; i--) {
+      if (size >= SizeOfClass(i)) {
+        return size < 2 * SizeOfClass(i) ? i : -1;
+      }
+    }
+    return -1;
+  }
+
+  Shard& CurrentShard() {
+    return shards_[static_cast<unsigned>(base::OS::GetCurrentThreadId()) %
+                   kNumberOfShards];
+  }
+
+  const size_t shard_capacity_;
+  Shard shards_[kNumberOfShards];
+  std::atomic<size_t> pooled_bytes_{0};
+};
+
 AccountingAllocator::AccountingAllocator()
     : zone_backing_malloc_(
           V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetMallocFn()),
@@ -77,10 +197,25 @@ AccountingAllocator::AccountingAllocator()
     bounded_page_allocator_ = CreateBoundedAllocator(platform_page_allocator,
                                                      reserved_area_->address());
   }
+#ifndef V8_USE_ADDRESS_SANITIZER
+  // Reusing segments would hide use-after-free bugs on zone memory from ASan.
+  if (v8_flags.zone_segment_pool_size > 0) {
+    segment_pool_ =
+        std::make_unique<SegmentPool>(v8_flags.zone_segment_pool_size * KB);
+  }
+#endif  // V8_USE_ADDRESS_SANITIZER
 }
 
 AccountingAllocator::~AccountingAllocator() = default;
 
+size_t AccountingAllocator::GetPooledMemory() const {
+  return segment_pool_ ? segment_pool_->pooled_bytes() : 0;
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  if (segment_pool_) segment_pool_->ReleaseAll();
+}
+
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
   void* memory;
@@ -90,9 +225,12 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
   } else {
-    auto result = AllocAtLeastWithRetry(bytes);
-    memory = result.ptr;
-    bytes = result.count;
+    memory = segment_pool_ ? segment_pool_->TryGet(bytes, &bytes) : nullptr;
+    if (memory == nullptr) {
+      auto result = AllocAtLeastWithRetry(bytes);
+      memory = result.ptr;
+      bytes = result.count;
+    }
   }
   if (memory == nullptr) return nullptr;
 
@@ -115,7 +253,7 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
-  } else {
+  } else if (!segment_pool_ || !segment_pool_->TryPut(segment, segment_size)) {
     free(segment);
   }
 }
@@ -46,6 +46,13 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Returns the number of bytes held by segments that were returned and are
+  // kept for reuse (not included in the current memory usage).
+  size_t GetPooledMemory() const;
+
+  // Frees all segments kept for reuse, e.g. under memory pressure.
+  void ReleasePooledSegments();
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -67,12 +74,18 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  class SegmentPool;
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
 
+  // Pool of returned (uncompressed) segments, to avoid malloc/free churn when
+  // many short-lived zones are created, e.g. by concurrent compilation jobs.
+  std::unique_ptr<SegmentPool> segment_pool_;
+
   ZoneBackingAllocator::MallocFn zone_backing_malloc_ = nullptr;
   ZoneBackingAllocator::FreeFn zone_backing_free_ = nullptr;
 };
@@ -20871,6 +20871,78 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+THREADED_TEST(JSONParseUtf8Chunks) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  Local<Object> global = context->Global();
+
+  // ASCII chunks, including an empty one.
+  const char* ascii[] = {"{\"x\":", "", "[1, 2", "]}"};
+  v8::MemorySpan<const char> ascii_chunks[] = {
+      {ascii[0], strlen(ascii[0])},
+      {ascii[1], strlen(ascii[1])},
+      {ascii[2], strlen(ascii[2])},
+      {ascii[3], strlen(ascii[3])}};
+  Local<Value> obj =
+      v8::JSON::Parse(context.local(), {ascii_chunks, 4}).ToLocalChecked();
+  global->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectString("JSON.stringify(obj)", "{\"x\":[1,2]}");
+
+  // A two-byte UTF-8 sequence (U+00E9) split across chunks.
+  const char* split[] = {"[\"caf\xC3", "\xA9\"]"};
+  v8::MemorySpan<const char> split_chunks[] = {{split[0], strlen(split[0])},
+                                               {split[1], strlen(split[1])}};
+  obj = v8::JSON::Parse(context.local(), {split_chunks, 2}).ToLocalChecked();
+  global->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectTrue("obj[0] === 'caf\\u00e9'");
+
+  // A four-byte sequence (U+1F600) spread over three chunks, followed by a
+  // truncated sequence that is replaced by U+FFFD when the next chunk does
+  // not continue it.
+  const char* spread[] = {"[\"\xF0", "\x9F\x98", "", "\x80\xE2\x82", "\"]"};
+  v8::MemorySpan<const char> spread_chunks[] = {
+      {spread[0], strlen(spread[0])},
+      {spread[1], strlen(spread[1])},
+      {spread[2], strlen(spread[2])},
+      {spread[3], strlen(spread[3])},
+      {spread[4], strlen(spread[4])}};
+  obj = v8::JSON::Parse(context.local(), {spread_chunks, 5}).ToLocalChecked();
+  global->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectTrue("obj[0] === '\\u{1f600}\\ufffd'");
+
+  // A single non-ASCII chunk.
+  const char* single = "\"\xE2\x82\xAC\"";
+  v8::MemorySpan<const char> single_chunk[] = {{single, strlen(single)}};
+  obj = v8::JSON::Parse(context.local(), {single_chunk, 1}).ToLocalChecked();
+  global->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectTrue("obj === '\\u20ac'");
+
+  // Syntax errors are reported as for JSON::Parse(String).
+  {
+    v8::TryCatch try_catch(isolate);
+    CHECK(v8::JSON::Parse(context.local(), {ascii_chunks, 3}).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+
+  // So is empty input, whether there are no chunks or only empty ones.
+  {
+    v8::TryCatch try_catch(isolate);
+    CHECK(v8::JSON::Parse(context.local(),
+                          v8::MemorySpan<const v8::MemorySpan<const char>>())
+              .IsEmpty());
+    CHECK(try_catch.HasCaught());
+    CHECK(try_catch.Exception()->IsNativeError());
+  }
+  {
+    v8::TryCatch try_catch(isolate);
+    v8::MemorySpan<const char> empty_chunks[] = {{"", 0}, {"", 0}};
+    CHECK(v8::JSON::Parse(context.local(), {empty_chunks, 2}).IsEmpty());
+    CHECK(try_catch.HasCaught());
+    CHECK(try_catch.Exception()->IsNativeError());
+  }
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -20899,6 +20971,79 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+class StringUtf8Sink : public v8::JSON::Utf8Sink {
+ public:
+  void Append(const char* data, size_t length) override {
+    result_.append(data, length);
+    appends_++;
+  }
+  const std::string& result() const { return result_; }
+  int appends() const { return appends_; }
+
+ private:
+  std::string result_;
+  int appends_ = 0;
+};
+
+void CheckStringifyToUtf8(v8::Local<v8::Context> context, const char* source,
+                          const char* gap = nullptr) {
+  v8::Isolate* isolate = context->GetIsolate();
+  Local<Value> value = CompileRun(source);
+  Local<String> gap_string = gap ? v8_str(gap) : Local<String>();
+  Local<String> expected =
+      v8::JSON::Stringify(context, value, gap_string).ToLocalChecked();
+  StringUtf8Sink sink;
+  CHECK(v8::JSON::StringifyToUtf8(context, value, &sink, gap_string)
+            .FromJust());
+  CHECK_EQ(std::string(*v8::String::Utf8Value(isolate, expected)),
+           sink.result());
+}
+}  // namespace
+
+THREADED_TEST(JSONStringifyToUtf8) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+
+  CheckStringifyToUtf8(context.local(), "({x: 42, y: [1, 'two', null]})");
+  CheckStringifyToUtf8(context.local(), "({x: {y: 1}})", "  ");
+  CheckStringifyToUtf8(context.local(), "'caf\\u00e9 \\u00ff'");
+  CheckStringifyToUtf8(context.local(), "['\\u20ac', '\\ud83d\\ude00']");
+  CheckStringifyToUtf8(context.local(), "'\\ud800 lone surrogate'");
+  CheckStringifyToUtf8(context.local(), "'\\u00e9'.repeat(3000)");
+  CheckStringifyToUtf8(context.local(), "'\\u20ac'.repeat(3000)");
+
+  // Values without a JSON representation write nothing.
+  const char* unchanged[] = {"undefined", "(function() {})", "Symbol()"};
+  for (const char* source : unchanged) {
+    StringUtf8Sink unchanged_sink;
+    Local<Value> unchanged_value = CompileRun(source);
+    CHECK(!v8::JSON::StringifyToUtf8(context.local(), unchanged_value,
+                                     &unchanged_sink)
+               .FromJust());
+    CHECK_EQ(0, unchanged_sink.appends());
+  }
+
+  // Long ASCII runs are passed on in one piece.
+  StringUtf8Sink sink;
+  Local<Value> value = CompileRun("'x'.repeat(10000)");
+  CHECK(v8::JSON::StringifyToUtf8(context.local(), value, &sink).FromJust());
+  CHECK_EQ(1, sink.appends());
+  CHECK_EQ(10002u, sink.result().size());
+
+  // Exceptions are propagated.
+  {
+    v8::TryCatch try_catch(isolate);
+    StringUtf8Sink throwing_sink;
+    value = CompileRun("({toJSON() { throw 1; }})");
+    CHECK(v8::JSON::StringifyToUtf8(context.local(), value, &throwing_sink)
+              .IsNothing());
+    CHECK(try_catch.HasCaught());
+    CHECK(throwing_sink.result().empty());
+  }
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <sstream>
+
 #include "src/execution/isolate.h"
 #include "src/interpreter/bytecodes.h"
 #include "src/interpreter/interpreter.h"
@@ -126,5 +128,32 @@ TEST(IgnitionStatisticsExtension) {
   CHECK(non_empty_result->BooleanValue(isolate));
 }
 
+TEST(IgnitionTopDispatchPairs) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  IgnitionStatisticsTester tester(CcTest::i_isolate());
+
+  tester.SetDispatchCounter(interpreter::Bytecode::kLdar,
+                            interpreter::Bytecode::kStar, 1);
+  tester.SetDispatchCounter(interpreter::Bytecode::kMov,
+                            interpreter::Bytecode::kLdar, 6);
+  tester.SetDispatchCounter(interpreter::Bytecode::kLdar,
+                            interpreter::Bytecode::kAdd, 3);
+
+  std::ostringstream os;
+  CcTest::i_isolate()->interpreter()->PrintTopDispatchPairs(os, 2);
+  std::string output = os.str();
+
+  CHECK_NE(output.find("Top 2 of 3 bytecode dispatch pairs (10 dispatches)"),
+           std::string::npos);
+  size_t mov_ldar = output.find("Mov -> Ldar");
+  size_t ldar_add = output.find("Ldar -> Add");
+  CHECK_NE(mov_ldar, std::string::npos);
+  CHECK_NE(ldar_add, std::string::npos);
+  CHECK_LT(mov_ldar, ldar_add);
+  CHECK_NE(output.find("60.00%"), std::string::npos);
+  CHECK_EQ(output.find("Ldar -> Star"), std::string::npos);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -35,10 +35,12 @@
 #include "include/v8-locker.h"
 #include "include/v8-snapshot.h"
 #include "src/api/api-inl.h"
+#include "src/builtins/builtins.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/script-details.h"
 #include "src/common/assert-scope.h"
+#include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/debug/debug-coverage.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/parked-scope-inl.h"
@@ -49,6 +51,7 @@
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/objects/literal-objects-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/runtime/runtime.h"
 #include "src/snapshot/code-serializer.h"
@@ -65,6 +68,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 #include "test/cctest/setup-isolate-for-tests.h"
+#include "test/common/flag-utils.h"
 namespace v8 {
 namespace internal {
 
@@ -478,6 +482,36 @@ UNINITIALIZED_TEST(SnapshotCompression) {
   shared_space_blob.Dispose();
   context_blob.Dispose();
 }
+
+UNINITIALIZED_TEST(SnapshotCompressionLevels) {
+  DisableAlwaysOpt();
+  base::Vector<const uint8_t> startup_blob;
+  base::Vector<const uint8_t> read_only_blob;
+  base::Vector<const uint8_t> shared_space_blob;
+  base::Vector<const uint8_t> context_blob;
+  SerializeContext(&startup_blob, &read_only_blob, &shared_space_blob,
+                   &context_blob);
+  SnapshotData original_snapshot_data(context_blob);
+  size_t stored_size = 0;
+  size_t best_size = 0;
+  for (int level : {0, 1, 9}) {
+    FlagScope<int> compression_level(&v8_flags.snapshot_compression_level,
+                                     level);
+    SnapshotData compressed =
+        i::SnapshotCompression::Compress(&original_snapshot_data);
+    SnapshotData decompressed =
+        i::SnapshotCompression::Decompress(compressed.RawData());
+    CHECK_EQ(context_blob, decompressed.RawData());
+    if (level == 0) stored_size = compressed.RawData().size();
+    if (level == 9) best_size = compressed.RawData().size();
+  }
+  CHECK_LT(best_size, stored_size);
+
+  startup_blob.Dispose();
+  read_only_blob.Dispose();
+  shared_space_blob.Dispose();
+  context_blob.Dispose();
+}
 #endif  // SNAPSHOT_COMPRESSION
 
 UNINITIALIZED_TEST(ContextSerializerContext) {
@@ -532,7 +566,8 @@ static void SerializeCustomContext(
     base::Vector<const uint8_t>* startup_blob_out,
     base::Vector<const uint8_t>* read_only_blob_out,
     base::Vector<const uint8_t>* shared_space_blob_out,
-    base::Vector<const uint8_t>* context_blob_out) {
+    base::Vector<const uint8_t>* context_blob_out,
+    const char* extra_source = nullptr) {
   v8::Isolate* isolate = TestSerializer::NewIsolateInitialized();
   Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
   {
@@ -569,6 +604,7 @@ static void SerializeCustomContext(
           isolate, source.begin(), v8::NewStringType::kNormal, source.length());
       CompileRun(source_str.ToLocalChecked());
       source.Dispose();
+      if (extra_source != nullptr) CompileRun(extra_source);
     }
     // If we don't do this then we end up with a stray root pointing at the
     // context even after we have disposed of env.
@@ -749,6 +785,104 @@ UNINITIALIZED_TEST(ContextSerializerCustomContext) {
   FreeCurrentEmbeddedBlob();
 }
 
+UNINITIALIZED_TEST(ContextSerializerPromotesLiteralBoilerplates) {
+  DisableAlwaysOpt();
+  // Keep the bytecode, and with it the boilerplate descriptions in its
+  // constant pool, alive across the GCs that precede serialization.
+  FlagScope<bool> flush_bytecode(&v8_flags.flush_bytecode, false);
+  // Object boilerplates can only be promoted if their keys already are in RO
+  // space, hence the choice of property names.
+  const char* source =
+      "function array_literal() { return [1, 2, 3]; }"
+      "function object_literal() { return {name: 1, value: 2}; }"
+      "array_literal(); object_literal();";
+  base::Vector<const uint8_t> startup_blob;
+  base::Vector<const uint8_t> read_only_blob;
+  base::Vector<const uint8_t> shared_space_blob;
+  base::Vector<const uint8_t> context_blob;
+  SerializeCustomContext(&startup_blob, &read_only_blob, &shared_space_blob,
+                         &context_blob, source);
+
+  StartupBlobs blobs = {startup_blob, read_only_blob, shared_space_blob};
+  v8::Isolate* v8_isolate = TestSerializer::NewIsolateFromBlob(blobs);
+  CHECK(v8_isolate);
+  {
+    v8::Isolate::Scope isolate_scope(v8_isolate);
+
+    Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+    HandleScope handle_scope(isolate);
+    Handle<JSGlobalProxy> global_proxy =
+        isolate->factory()->NewUninitializedJSGlobalProxy(
+            JSGlobalProxy::SizeWithEmbedderFields(0));
+    SnapshotData snapshot_data(context_blob);
+    Handle<Object> root =
+        ContextDeserializer::DeserializeContext(
+            isolate, &snapshot_data, 0, false, global_proxy,
+            v8::DeserializeInternalFieldsCallback())
+            .ToHandleChecked();
+    Handle<NativeContext> context = Handle<NativeContext>::cast(root);
+    Handle<Context>::cast(context)->set(
+        Context::NEXT_CONTEXT_LINK, isolate->heap()->native_contexts_list(),
+        UPDATE_WRITE_BARRIER);
+    isolate->heap()->set_native_contexts_list(*context);
+
+    v8::Local<v8::Context> v8_context = v8::Utils::ToLocal(context);
+    v8::Context::Scope context_scope(v8_context);
+
+    // Returns the only entry of the function's constant pool that is a
+    // boilerplate description.
+    auto get_boilerplate = [&](const char* name) {
+      Handle<JSFunction> function =
+          Handle<JSFunction>::cast(v8::Utils::OpenHandle(*CompileRun(name)));
+      Tagged<FixedArray> constant_pool =
+          function->shared()->GetBytecodeArray(isolate)->constant_pool();
+      Handle<HeapObject> boilerplate;
+      for (int i = 0; i < constant_pool->length(); i++) {
+        Tagged<Object> entry = constant_pool->get(i);
+        if (IsArrayBoilerplateDescription(entry) ||
+            IsObjectBoilerplateDescription(entry)) {
+          CHECK(boilerplate.is_null());
+          boilerplate = handle(HeapObject::cast(entry), isolate);
+        }
+      }
+      CHECK(!boilerplate.is_null());
+      return boilerplate;
+    };
+
+    Handle<HeapObject> object_boilerplate = get_boilerplate("object_literal");
+    CHECK(IsObjectBoilerplateDescription(*object_boilerplate));
+    CHECK(ReadOnlyHeap::Contains(*object_boilerplate));
+
+    Handle<HeapObject> array_boilerplate = get_boilerplate("array_literal");
+    CHECK(IsArrayBoilerplateDescription(*array_boilerplate));
+    CHECK(ReadOnlyHeap::Contains(*array_boilerplate));
+    Handle<FixedArrayBase> constant_elements(
+        ArrayBoilerplateDescription::cast(*array_boilerplate)
+            ->constant_elements(),
+        isolate);
+    CHECK_EQ(ReadOnlyRoots(isolate).fixed_cow_array_map(),
+             constant_elements->map());
+    CHECK(ReadOnlyHeap::Contains(*constant_elements));
+
+    // Arrays created from the boilerplate share its copy-on-write elements
+    // until they are first written to.
+    CHECK_EQ(99,
+             CompileRun("var copy = array_literal(); copy[0] = 99; copy[0]")
+                 ->Int32Value(v8_context)
+                 .FromJust());
+    Handle<JSArray> copy =
+        Handle<JSArray>::cast(v8::Utils::OpenHandle(*CompileRun("copy")));
+    CHECK(!ReadOnlyHeap::Contains(copy->elements()));
+    CHECK_EQ(
+        1, CompileRun("array_literal()[0]")->Int32Value(v8_context).FromJust());
+    CHECK_EQ(1, Smi::ToInt(FixedArray::cast(*constant_elements)->get(0)));
+  }
+  context_blob.Dispose();
+  v8_isolate->Dispose();
+  blobs.Dispose();
+  FreeCurrentEmbeddedBlob();
+}
+
 UNINITIALIZED_TEST(CustomSnapshotDataBlob1) {
   DisableAlwaysOpt();
   const char* source1 = "function f() { return 42; }";
@@ -3056,6 +3190,264 @@ TEST(CodeSerializerAfterExecute) {
   v8_flags.always_turbofan = prev_always_turbofan_value;
 }
 
+TEST(CodeSerializerStartupProfile) {
+  // Functions compiled while the startup profile is being recorded keep that
+  // mark in the code cache.
+  FlagScope<bool> startup_profile(&v8_flags.code_cache_startup_profile, true);
+  FlagList::EnforceFlagImplications();
+  const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    int startup_functions = 0;
+    SharedFunctionInfo::ScriptIterator iter(
+        i_isolate2, Script::cast(toplevel->script()));
+    for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      if (info->is_toplevel()) continue;
+      CHECK(info->compiled_during_startup());
+      CHECK(info->is_compiled());
+      startup_functions++;
+    }
+    CHECK_EQ(1, startup_functions);
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerStartupProfileRecompilesFlushedFunctions) {
+  // A function that ran during startup, but whose bytecode was flushed before
+  // the cache was created, is handed to the LazyCompileDispatcher on load.
+  // Background tasks need an external source to parse from.
+  FlagScope<bool> startup_profile(&v8_flags.code_cache_startup_profile, true);
+  FlagList::EnforceFlagImplications();
+  const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  SerializerOneByteResource resource1(js_source, strlen(js_source));
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  Isolate* i_isolate1 = reinterpret_cast<Isolate*>(isolate1);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str =
+        v8::String::NewExternalOneByte(isolate1, &resource1).ToLocalChecked();
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->StrictEquals(v8_str("abcdef")));
+
+    Handle<JSFunction> f = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *context->Global()->Get(context, v8_str("f")).ToLocalChecked()));
+    Handle<SharedFunctionInfo> shared(f->shared(), i_isolate1);
+    CHECK(shared->compiled_during_startup());
+    SharedFunctionInfo::DiscardCompiled(i_isolate1, shared);
+    f->set_code(*BUILTIN_CODE(i_isolate1, CompileLazy));
+
+    cache = v8::ScriptCompiler::CreateCodeCache(script);
+  }
+  isolate1->Dispose();
+
+  SerializerOneByteResource resource2(js_source, strlen(js_source));
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str =
+        v8::String::NewExternalOneByte(isolate2, &resource2).ToLocalChecked();
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    Handle<SharedFunctionInfo> f;
+    {
+      SharedFunctionInfo::ScriptIterator iter(
+          i_isolate2, Script::cast(toplevel->script()));
+      for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+           info = iter.Next()) {
+        if (!info->is_toplevel()) f = handle(info, i_isolate2);
+      }
+    }
+    CHECK(!f.is_null());
+    CHECK(f->compiled_during_startup());
+    CHECK(!f->is_compiled());
+    CHECK(i_isolate2->lazy_compile_dispatcher()->IsEnqueued(f));
+
+    // The first call picks up the result of the background compile.
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->StrictEquals(v8_str("abcdef")));
+    CHECK(f->is_compiled());
+    CHECK(!i_isolate2->lazy_compile_dispatcher()->IsEnqueued(f));
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
+TEST(CodeSerializerAgeDeserializedBytecode) {
+  FlagScope<bool> age_bytecode(&v8_flags.code_cache_age_deserialized_bytecode,
+                               true);
+  if (!v8_flags.flush_bytecode || v8_flags.flush_code_based_on_time ||
+      v8_flags.flush_code_based_on_tab_visibility) {
+    return;
+  }
+  const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    SharedFunctionInfo::ScriptIterator iter(
+        i_isolate2, Script::cast(toplevel->script()));
+    for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      if (info->is_toplevel()) continue;
+      CHECK(info->HasBytecodeArray());
+      CHECK_EQ(v8_flags.bytecode_old_age - 1, info->age());
+    }
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerAgeDeserializedBytecodeKeepsStartupFunctions) {
+  // Functions recorded by the startup profile are about to run again, so they
+  // must not be aged towards flushing on load.
+  FlagScope<bool> startup_profile(&v8_flags.code_cache_startup_profile, true);
+  FlagScope<bool> age_bytecode(&v8_flags.code_cache_age_deserialized_bytecode,
+                               true);
+  FlagList::EnforceFlagImplications();
+  if (!v8_flags.flush_bytecode || v8_flags.flush_code_based_on_time ||
+      v8_flags.flush_code_based_on_tab_visibility) {
+    return;
+  }
+  const char* js_source =
+      "function f() { return 'abc'; }; function g() { return 'def'; };"
+      "f() + g()";
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->StrictEquals(v8_str("abcdef")));
+
+    // Pretend that g was first compiled after the startup window.
+    Handle<JSFunction> g = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *context->Global()->Get(context, v8_str("g")).ToLocalChecked()));
+    CHECK(g->shared()->compiled_during_startup());
+    g->shared()->set_compiled_during_startup(false);
+
+    cache = v8::ScriptCompiler::CreateCodeCache(script);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    int startup_functions = 0;
+    int aged_functions = 0;
+    SharedFunctionInfo::ScriptIterator iter(
+        i_isolate2, Script::cast(toplevel->script()));
+    for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      if (info->is_toplevel()) continue;
+      CHECK(info->HasBytecodeArray());
+      if (info->compiled_during_startup()) {
+        CHECK_LT(info->age(), v8_flags.bytecode_old_age - 1);
+        startup_functions++;
+      } else {
+        CHECK_EQ(v8_flags.bytecode_old_age - 1, info->age());
+        aged_functions++;
+      }
+    }
+    CHECK_EQ(1, startup_functions);
+    CHECK_EQ(1, aged_functions);
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
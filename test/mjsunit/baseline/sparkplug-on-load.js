@@ -0,0 +1,16 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --sparkplug --sparkplug-on-load --no-always-sparkplug
+// Flags: --no-concurrent-sparkplug --allow-natives-syntax
+// Flags: --no-always-turbofan --no-lazy-feedback-allocation
+
+// Eagerly compiled functions are compiled with Sparkplug as soon as the
+// script has been compiled, before they ever run.
+var eager = (function eager(a, b) {
+  return a + b;
+});
+
+assertTrue(isBaseline(eager));
+assertEquals(3, eager(1, 2));
@@ -0,0 +1,27 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --turbo-compile-memory-budget=1
+// Flags: --turbo-compile-time-budget=1
+
+// Jobs exceeding their compile budget skip optional phases (load elimination,
+// escape analysis, loop peeling, ...) but must still produce correct code.
+
+function f(o, n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    const p = {x: o.x + i, y: o.y};
+    sum += p.x * p.y;
+    o.x = o.x + 1;
+    sum -= o.x;
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(f);
+const expected = f({x: 1, y: 2}, 10);
+f({x: 1, y: 2}, 10);
+%OptimizeFunctionOnNextCall(f);
+assertEquals(expected, f({x: 1, y: 2}, 10));
+assertOptimized(f);
@@ -0,0 +1,35 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --turbo-inlining-cost-model
+// Flags: --max-inlined-bytecode-size-small=0
+
+// Call sites passing constants or freshly allocated objects get their callee's
+// size discounted by the inlining cost model; the result must not change.
+
+function norm(p, scale) {
+  return (p.x * p.x + p.y * p.y) * scale;
+}
+
+function Point(x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+function f(a, b) {
+  const fresh = norm({x: a, y: b}, 2);
+  const constant = norm({x: 3, y: 4}, 1);
+  const unknown = norm(new Point(a, b), a);
+  return fresh + constant + unknown;
+}
+
+%PrepareFunctionForOptimization(norm);
+%PrepareFunctionForOptimization(Point);
+%PrepareFunctionForOptimization(f);
+assertEquals(10 + 25 + 5, f(1, 2));
+assertEquals(10 + 25 + 5, f(1, 2));
+%OptimizeFunctionOnNextCall(f);
+assertEquals(10 + 25 + 5, f(1, 2));
+assertEquals(52 + 25 + 26, f(1, 5));
+assertOptimized(f);
@@ -0,0 +1,23 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-instruction-scheduling --mcpu=atom
+
+// Exercise the Atom latency model of the instruction scheduler on a kernel
+// mixing integer division, multiplication and float arithmetic.
+function kernel(a, b, n) {
+  let acc = 0;
+  let iacc = 0;
+  for (let i = 1; i < n; i++) {
+    acc += Math.sqrt(a * i) / (b + i) - a * b;
+    iacc = (iacc + ((i * 7) | 0) % ((i & 3) + 1)) | 0;
+  }
+  return acc + iacc;
+}
+
+%PrepareFunctionForOptimization(kernel);
+const expected = kernel(3.5, 1.25, 100);
+kernel(3.5, 1.25, 100);
+%OptimizeFunctionOnNextCall(kernel);
+assertEquals(expected, kernel(3.5, 1.25, 100));
@@ -0,0 +1,57 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --turboshaft --no-turbo-escape
+
+// Turbofan's escape analysis is disabled so that the allocations below reach
+// Turboshaft, whose late escape analysis replaces the loads of their fields by
+// the initializing values.
+
+function point(x, y) {
+  const p = {x, y};
+  return p.x * p.y;
+}
+
+%PrepareFunctionForOptimization(point);
+assertEquals(6, point(2, 3));
+%OptimizeFunctionOnNextCall(point);
+assertEquals(6, point(2, 3));
+assertEquals(2.5, point(0.5, 5));
+assertEquals(NaN, point({}, 1));
+
+function pair(a, b) {
+  const arr = [a, b];
+  if (a > b) return arr[0] - arr[1];
+  return arr[1] - arr[0];
+}
+
+%PrepareFunctionForOptimization(pair);
+assertEquals(3, pair(1, 4));
+assertEquals(3, pair(4, 1));
+%OptimizeFunctionOnNextCall(pair);
+assertEquals(3, pair(1, 4));
+assertEquals(3, pair(4, 1));
+
+function nested(x) {
+  const inner = {v: x};
+  const outer = {inner, w: x + 1};
+  return outer.inner.v + outer.w;
+}
+
+%PrepareFunctionForOptimization(nested);
+assertEquals(3, nested(1));
+%OptimizeFunctionOnNextCall(nested);
+assertEquals(3, nested(1));
+assertEquals(21, nested(10));
+
+function closure(x) {
+  const f = () => x + 1;
+  return f();
+}
+
+%PrepareFunctionForOptimization(closure);
+assertEquals(2, closure(1));
+%OptimizeFunctionOnNextCall(closure);
+assertEquals(2, closure(1));
+assertEquals(11, closure(10));
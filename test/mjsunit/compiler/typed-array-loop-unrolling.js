@@ -0,0 +1,57 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --turboshaft
+// Flags: --turboshaft-loop-unrolling
+
+// Elementwise kernels over typed arrays are partially unrolled with a larger
+// size budget; check that the unrolled loops (including iteration counts that
+// are not a multiple of the unrolling factor) compute the right results.
+
+function axpy(a, x, y, n) {
+  for (let i = 0; i < n; i++) {
+    y[i] = a * x[i] + y[i];
+  }
+}
+
+function sum(x) {
+  let s = 0;
+  for (let i = 0; i < x.length; i++) {
+    s += x[i];
+  }
+  return s;
+}
+
+function run(n) {
+  const x = new Float64Array(n);
+  const y = new Float64Array(n);
+  for (let i = 0; i < n; i++) {
+    x[i] = i;
+    y[i] = n - i;
+  }
+  axpy(2, x, y, n);
+  return sum(y);
+}
+
+%PrepareFunctionForOptimization(axpy);
+%PrepareFunctionForOptimization(sum);
+const expected = [0, 1, 3, 7, 8, 101].map(run);
+%OptimizeFunctionOnNextCall(axpy);
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(expected, [0, 1, 3, 7, 8, 101].map(run));
+
+function add_int32(a, b, out) {
+  for (let i = 0; i < out.length; i++) {
+    out[i] = (a[i] + b[i]) | 0;
+  }
+}
+
+const a = new Int32Array([1, 2, 3, 4, 5, 6, 7]);
+const b = new Int32Array([7, 6, 5, 4, 3, 2, 1]);
+%PrepareFunctionForOptimization(add_int32);
+add_int32(a, b, new Int32Array(7));
+%OptimizeFunctionOnNextCall(add_int32);
+const out = new Int32Array(7);
+add_int32(a, b, out);
+assertEquals([8, 8, 8, 8, 8, 8, 8], Array.from(out));
@@ -0,0 +1,53 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Nested objects in arrays of records take their expected shape from the
+// same field of the previous record.
+(function TestNestedRecords() {
+  const records = JSON.parse(
+      '[{"id":1,"user":{"name":"a","age":1},"tags":["x"]},' +
+      ' {"id":2,"user":{"name":"b","age":2},"tags":["y"]},' +
+      ' {"id":3,"user":{"name":"c","age":3},"tags":[]}]');
+  assertEquals(3, records.length);
+  assertEquals({name: 'c', age: 3}, records[2].user);
+  assertTrue(%HaveSameMap(records[0], records[1]));
+  assertTrue(%HaveSameMap(records[1].user, records[2].user));
+  assertTrue(%HaveSameMap(records[0].user, records[2].user));
+})();
+
+// A mismatching prediction only costs a fallback.
+(function TestMismatchedShapes() {
+  const records = JSON.parse(
+      '[{"a":{"x":1,"y":2},"b":{"p":1}},' +
+      ' {"a":{"y":1,"x":2},"b":{"p":{"q":1}}},' +
+      ' {"b":{"x":1,"y":2},"a":{"p":1}},' +
+      ' {"a":1,"b":{"p":1,"q":2}},' +
+      ' {"a":{"x":1,"y":2,"z":3},"b":{}},' +
+      ' {"a":{"0":1,"x":2},"b":{"p":1.5}}]');
+  assertEquals({x: 1, y: 2}, records[0].a);
+  assertEquals({y: 1, x: 2}, records[1].a);
+  assertEquals({p: {q: 1}}, records[1].b);
+  assertEquals({x: 1, y: 2}, records[2].b);
+  assertEquals({p: 1}, records[2].a);
+  assertEquals({p: 1, q: 2}, records[3].b);
+  assertEquals({x: 1, y: 2, z: 3}, records[4].a);
+  assertEquals({0: 1, x: 2}, records[5].a);
+  assertEquals({p: 1.5}, records[5].b);
+  assertFalse(%HaveSameMap(records[0].a, records[1].a));
+})();
+
+// Parents with elements, and previous siblings in dictionary mode.
+(function TestNoPrediction() {
+  const wide = {};
+  for (let i = 0; i < 2000; i++) wide['k' + i] = i;
+  const json = JSON.stringify([{"w": wide, "v": {"x": 1}},
+                               {"w": wide, "v": {"x": 2}},
+                               {"0": 1, "v": {"x": 3}}]);
+  const records = JSON.parse(json);
+  assertEquals(wide, records[1].w);
+  assertEquals({x: 2}, records[1].v);
+  assertEquals({x: 3}, records[2].v);
+})();
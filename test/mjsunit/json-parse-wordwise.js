@@ -0,0 +1,50 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The JSON parser skips string contents and runs of spaces a word at a time.
+// Place interesting characters at every offset relative to word boundaries,
+// for both one-byte and two-byte sources.
+
+function pad(n) {
+  return 'abcdefghijklmnopqrstuvwxyz'.repeat(2).substring(0, n);
+}
+
+for (let prefix of ['', 'ሴ']) {
+  for (let i = 0; i < 20; i++) {
+    for (let j = 0; j < 20; j++) {
+      let head = prefix + pad(i);
+      let tail = pad(j);
+
+      assertEquals(head + '"' + tail,
+                   JSON.parse('"' + head + '\\"' + tail + '"'));
+      assertEquals(head + '\n' + tail,
+                   JSON.parse('"' + head + '\\n' + tail + '"'));
+      assertEquals(head + 'é' + tail,
+                   JSON.parse('"' + head + 'é' + tail + '"'));
+      assertEquals(head + ' ' + tail,
+                   JSON.parse('"' + head + ' ' + tail + '"'));
+      assertEquals({[head]: tail},
+                   JSON.parse('{"' + head + '":"' + tail + '"}'));
+
+      assertThrows(() => JSON.parse('"' + head + '\n' + tail + '"'),
+                   SyntaxError);
+      assertThrows(() => JSON.parse('"' + head + '\x1f' + tail + '"'),
+                   SyntaxError);
+      assertThrows(() => JSON.parse('"' + head + tail), SyntaxError);
+    }
+  }
+}
+
+for (let i = 0; i < 40; i++) {
+  let spaces = ' '.repeat(i);
+  assertEquals([1, 2], JSON.parse('[' + spaces + '1,' + spaces + '2]'));
+  assertEquals([1, 2], JSON.parse('[\n' + spaces + '1,\n' + spaces + '2\n]'));
+  assertEquals([1, 2],
+               JSON.parse(spaces + '[1,\t' + spaces + '2]' + spaces));
+  assertThrows(() => JSON.parse('[' + spaces + '1 ' + spaces + 'x]'),
+               SyntaxError);
+}
+
+let value = {a: [1, 'two', {b: 'x'.repeat(100)}], c: 'ሴ'.repeat(9)};
+assertEquals(value, JSON.parse(JSON.stringify(value, null, 32)));
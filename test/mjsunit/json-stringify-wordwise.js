@@ -0,0 +1,69 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.stringify copies runs of characters that don't need escaping a word at
+// a time. Place interesting characters at every offset relative to word
+// boundaries, for both one-byte and two-byte strings, and compare against a
+// character-by-character reference.
+
+function quote(s) {
+  const kShortEscapes = {8: 'b', 9: 't', 10: 'n', 12: 'f', 13: 'r'};
+  let result = '"';
+  for (let k = 0; k < s.length; k++) {
+    const c = s.charCodeAt(k);
+    if (c == 0x22 || c == 0x5C) {
+      result += '\\' + s[k];
+    } else if (c < 0x20) {
+      result += c in kShortEscapes ?
+          '\\' + kShortEscapes[c] :
+          '\\u' + c.toString(16).padStart(4, '0');
+    } else if (c >= 0xD800 && c <= 0xDBFF && k + 1 < s.length &&
+               s.charCodeAt(k + 1) >= 0xDC00 && s.charCodeAt(k + 1) <= 0xDFFF) {
+      result += s[k] + s[k + 1];
+      k++;
+    } else if (c >= 0xD800 && c <= 0xDFFF) {
+      result += '\\u' + c.toString(16);
+    } else {
+      result += s[k];
+    }
+  }
+  return result + '"';
+}
+
+function pad(n) {
+  return 'abcdefghijklmnopqrstuvwxyz'.repeat(2).substring(0, n);
+}
+
+const kSpecials = [
+  '"', '\\', '\n', '\x01', '\x1f', ' ', '!', '#', '[', ']', '\x7f', '\xe9',
+  '\xff'
+];
+const kTwoByteSpecials = [
+  '\u0100', '\u0122', '\u1234', '\u225c', '\u5c5c', '\ud7ff', '\ud800',
+  '\udbff', '\udc00', '\udfff', '\ue000', '\uffff', '\ud83d\ude00',
+  '\ude00\ud83d'
+];
+
+for (let prefix of ['', '\u1234']) {
+  const specials =
+      prefix == '' ? kSpecials : kSpecials.concat(kTwoByteSpecials);
+  for (let special of specials) {
+    for (let i = 0; i < 18; i++) {
+      for (let j = 0; j < 18; j++) {
+        const s = prefix + pad(i) + special + pad(j);
+        assertEquals(quote(s), JSON.stringify(s));
+      }
+    }
+  }
+}
+
+// Strings which don't fit in the current output part take a different path.
+for (let prefix of ['', '\u1234']) {
+  const long = prefix + pad(50).repeat(1000);
+  assertEquals(quote(long), JSON.stringify(long));
+  const escaped = (prefix + pad(37) + '"\n\\' + '\ud800').repeat(1000);
+  assertEquals(quote(escaped), JSON.stringify(escaped));
+  assertEquals('[' + quote(escaped) + ',' + quote(long) + ']',
+               JSON.stringify([escaped, long]));
+}
@@ -0,0 +1,31 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-feedback-cell-calls
+
+function makeAdder(x) {
+  return (y) => x + y;
+}
+
+function apply(f, y) {
+  return f(y);
+}
+
+// Several closures of the same function leave a feedback cell (rather than a
+// single JSFunction) in the call feedback of {apply}.
+let add1 = makeAdder(1);
+let add2 = makeAdder(2);
+let add3 = makeAdder(3);
+
+%PrepareFunctionForOptimization(apply);
+assertEquals(2, apply(add1, 1));
+assertEquals(3, apply(add2, 1));
+%OptimizeMaglevOnNextCall(apply);
+assertEquals(4, apply(add3, 1));
+assertEquals(5, apply(add2, 3));
+assertTrue(isMaglevved(apply));
+
+// A closure of a different function fails the feedback cell check.
+assertEquals(6, apply((y) => y * 2, 3));
+assertFalse(isMaglevved(apply));
@@ -0,0 +1,46 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-stress-opt
+// Flags: --no-baseline-batch-compilation --use-osr --turbofan
+// Flags: --max-bytecode-size-for-early-opt=0
+// Flags: --concurrent-osr --concurrent-recompilation
+// Flags: --maglev-osr-from-hot-loops
+//
+// --osr-from-maglev is implied by --maglev-osr-from-hot-loops and deliberately
+// not passed here.
+
+// A function that was tiered up to Maglev through a regular (non-OSR) call
+// must leave a long-running loop for Turbofan once the interrupt budget checks
+// in the loop have requested Turbofan code. Nothing here asks for OSR
+// explicitly.
+
+let keep_going = 100000000;  // A counter to avoid test hangs on failure.
+
+function f(n) {
+  let sum = 0;
+  for (let i = 0; i < n && --keep_going; i++) {
+    sum += i;
+    if (%CurrentFrameIsTurbofan()) return sum;
+  }
+  return -1;
+}
+
+function g() {
+  assertTrue(%IsMaglevEnabled());
+  assertTrue(%IsTurbofanEnabled());
+
+  // Tier up through the regular heuristics. Marking |f| for manual
+  // optimization would stop the tiering manager from requesting Turbofan code
+  // below.
+  while (!%ActiveTierIsMaglev(f) && --keep_going) f(10);
+
+  // The Maglev frame for this call was not entered through OSR, so the only
+  // way out of the loop is the hot-loop check.
+  assertTrue(f(Number.MAX_SAFE_INTEGER) >= 0);
+  assertTrue(keep_going > 0);
+}
+%NeverOptimizeFunction(g);
+
+g();
@@ -0,0 +1,44 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-compile-tasks-for-likely-called --use-external-strings
+
+function calledFromTopLevel(a, b) {
+  return a + b;
+}
+
+function calledLater(a) {
+  return a * 2;
+}
+
+function neverCalled() {
+  return 42;
+}
+
+async function asyncCalled() {
+  return 1;
+}
+
+function* generatorCalled() {
+  yield 1;
+  yield 2;
+}
+
+assertEquals(3, calledFromTopLevel(1, 2));
+
+{
+  // Calls from nested blocks are still top-level code.
+  assertEquals(4, calledLater(2));
+}
+
+asyncCalled().then(v => assertEquals(1, v));
+
+var gen = generatorCalled();
+assertEquals(1, gen.next().value);
+assertEquals(2, gen.next().value);
+
+// Calls from inside functions don't count, but must still work.
+(function() {
+  assertEquals(42, neverCalled());
+})();
@@ -0,0 +1,43 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-compile-tasks-for-eager-toplevel
+// Flags: --parallel-compile-tasks-for-lazy
+// Flags: --parallel-compile-tasks-min-function-size=100
+
+// Small lazy functions stay on the main thread and are compiled lazily.
+function lazy_small_declaration() { return 1; }
+assertEquals(1, lazy_small_declaration());
+
+// Small eager functions have to be preparsed before their size is known, so
+// they are still handed to the dispatcher rather than parsed a second time.
+var small = (function(a) { return a + 1; });
+assertEquals(2, small(1));
+
+(function(a) {
+  assertEquals(a, "small IIFE");
+})("small IIFE");
+
+// Large functions are still handed to the dispatcher.
+var large = (function(a, b, c) {
+  var result = 0;
+  for (var i = 0; i < a; i++) {
+    result += b * i + c;
+  }
+  // Pad the body so that it is above the size threshold.
+  return result;
+});
+assertEquals(3 * 0 + 1 + 3 * 1 + 1 + 3 * 2 + 1, large(3, 3, 1));
+
+var result = (function recursive(a = 0) {
+  if (a == 1) {
+    // Pad the body so that it is above the size threshold.
+    return 42;
+  }
+  return recursive(1);
+})();
+assertEquals(42, result);
+
+function lazy_small() { return 42; }
+assertEquals(42, lazy_small());
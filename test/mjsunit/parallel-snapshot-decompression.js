@@ -0,0 +1,13 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-snapshot-decompression
+
+// The isolate and every new context are set up from the snapshot.
+assertEquals("function", typeof Array.prototype.map);
+assertEquals([2, 4, 6], [1, 2, 3].map(x => x * 2));
+
+var realm = Realm.create();
+assertEquals(6, Realm.eval(realm, "[1, 2, 3].reduce((a, b) => a + b)"));
+Realm.dispose(realm);
@@ -21,6 +21,7 @@
 #include "src/parsing/parsing.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/zone/zone-list-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -846,5 +847,47 @@ TEST_F(LazyCompileDispatcherTest, CompileMultipleOnBackgroundThread) {
   dispatcher.AbortAll();
 }
 
+TEST_F(LazyCompileDispatcherTest, ParallelCompileTasksMinFunctionSize) {
+  FlagScope<bool> for_lazy(&v8_flags.parallel_compile_tasks_for_lazy, true);
+  FlagScope<int> min_size(&v8_flags.parallel_compile_tasks_min_function_size,
+                          100);
+
+  static const char raw_source[] =
+      "function small() { return 1; }\n"
+      "function large(a, b) {\n"
+      "  // Pad the body so that it is above the size threshold.\n"
+      "  var result = 0;\n"
+      "  for (var i = 0; i < a; i++) result += b * i;\n"
+      "  return result;\n"
+      "}\n";
+  Handle<String> source = test::CreateSource(
+      i_isolate(), new test::ScriptResource(raw_source, strlen(raw_source)));
+  v8::ScriptCompiler::Source script_source(Utils::ToLocal(source));
+  v8::Local<v8::UnboundScript> script =
+      v8::ScriptCompiler::CompileUnboundScript(isolate(), &script_source)
+          .ToLocalChecked();
+
+  Handle<SharedFunctionInfo> small;
+  Handle<SharedFunctionInfo> large;
+  SharedFunctionInfo::ScriptIterator iter(
+      i_isolate(), Script::cast(Utils::OpenHandle(*script)->script()));
+  for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (info->Name()->IsOneByteEqualTo(base::StaticCharVector("small"))) {
+      small = handle(info, i_isolate());
+    } else if (info->Name()->IsOneByteEqualTo(
+                   base::StaticCharVector("large"))) {
+      large = handle(info, i_isolate());
+    }
+  }
+  ASSERT_FALSE(small.is_null());
+  ASSERT_FALSE(large.is_null());
+
+  LazyCompileDispatcher* dispatcher = i_isolate()->lazy_compile_dispatcher();
+  ASSERT_FALSE(dispatcher->IsEnqueued(small));
+  ASSERT_TRUE(dispatcher->IsEnqueued(large));
+  dispatcher->AbortAll();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,60 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/cpu-features.h"
+#include "src/compiler/backend/instruction-codes.h"
+#include "src/compiler/backend/instruction-scheduler.h"
+#include "src/compiler/backend/instruction.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class InstructionSchedulerTester {
+ public:
+  static int GetInstructionLatency(const Instruction* instr) {
+    return InstructionScheduler::GetInstructionLatency(instr);
+  }
+};
+
+class InstructionSchedulerX64Test : public TestWithZone {
+ public:
+  InstructionSchedulerX64Test()
+      : was_atom_(CpuFeatures::IsSupported(INTEL_ATOM)) {}
+  ~InstructionSchedulerX64Test() override { SetAtom(was_atom_); }
+
+  static void SetAtom(bool atom) {
+    if (atom) {
+      CpuFeatures::SetSupported(INTEL_ATOM);
+    } else {
+      CpuFeatures::SetUnsupported(INTEL_ATOM);
+    }
+  }
+
+  int Latency(ArchOpcode opcode, bool atom) {
+    SetAtom(atom);
+    return InstructionSchedulerTester::GetInstructionLatency(
+        Instruction::New(zone(), opcode));
+  }
+
+ private:
+  bool was_atom_;
+};
+
+TEST_F(InstructionSchedulerX64Test, AtomLatencies) {
+  // Divisions, square roots and multiplications are slower on Atom cores.
+  EXPECT_GT(Latency(kX64Idiv, true), Latency(kX64Idiv, false));
+  EXPECT_GT(Latency(kX64Udiv, true), Latency(kX64Udiv, false));
+  EXPECT_GT(Latency(kSSEFloat64Sqrt, true), Latency(kSSEFloat64Sqrt, false));
+  EXPECT_GT(Latency(kSSEFloat64Div, true), Latency(kSSEFloat64Div, false));
+  EXPECT_GT(Latency(kX64Imul, true), Latency(kX64Imul, false));
+  // Simple instructions have the same latency in both models.
+  EXPECT_EQ(Latency(kX64Add, true), Latency(kX64Add, false));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
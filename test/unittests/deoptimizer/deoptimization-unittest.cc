@@ -37,6 +37,7 @@
 #include "src/execution/isolate.h"
 #include "src/init/v8.h"
 #include "src/objects/objects-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/heap/heap-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -715,5 +716,112 @@ TEST_F(DeoptimizationDisableConcurrentRecompilationTest,
   CheckJsInt32(13, "result", context());
 }
 
+TEST_F(DeoptimizationTest, DeoptimizationStatistics) {
+  if (!i_isolate()->use_optimizer()) return;
+  FlagScope<bool> allow_natives_syntax(&v8_flags.allow_natives_syntax, true);
+  FlagScope<int> deopt_storm_threshold(&v8_flags.deopt_storm_threshold, 1);
+
+  RunJS(
+      "function add(a, b) { return a + b; }"
+      "%PrepareFunctionForOptimization(add);"
+      "add(1, 2); add(3, 4);"
+      "%OptimizeFunctionOnNextCall(add);"
+      "add(5, 6);"
+      "add(1.5, 2);");
+
+  v8::Isolate* isolate = v8_isolate();
+  size_t deopt_count = 0;
+  size_t despeculation_count = 0;
+  for (size_t i = 0; i < isolate->NumberOfDeoptimizationReasons(); i++) {
+    v8::DeoptimizationStatistics stats;
+    CHECK(isolate->GetDeoptimizationStatistics(&stats, i));
+    CHECK_NOT_NULL(stats.reason());
+    CHECK_LE(stats.despeculation_count(), stats.deopt_count());
+    if (stats.deopt_count() > 0) CHECK_EQ(1u, stats.function_count());
+    deopt_count += stats.deopt_count();
+    despeculation_count += stats.despeculation_count();
+  }
+  v8::DeoptimizationStatistics stats;
+  CHECK(!isolate->GetDeoptimizationStatistics(
+      &stats, isolate->NumberOfDeoptimizationReasons()));
+
+  // With a threshold of 1, the Smi-only feedback of the addition is widened
+  // on its first deopt.
+  CHECK_LE(1u, deopt_count);
+  CHECK_LE(1u, despeculation_count);
+}
+
+TEST_F(DeoptimizationTest, DeoptStormMakesLoadMegamorphic) {
+  if (!i_isolate()->use_optimizer()) return;
+  FlagScope<bool> allow_natives_syntax(&v8_flags.allow_natives_syntax, true);
+
+  // After a wrong-map deopt the interpreter only adds the new map to the load
+  // feedback, so the feedback stays polymorphic unless the deopt storm
+  // handling widens it.
+  for (int threshold : {0, 1}) {
+    FlagScope<int> deopt_storm_threshold(&v8_flags.deopt_storm_threshold,
+                                         threshold);
+    RunJS(
+        "var load = new Function('o', 'return o.x;');"
+        "%PrepareFunctionForOptimization(load);"
+        "load({x: 1}); load({x: 2});"
+        "%OptimizeFunctionOnNextCall(load);"
+        "load({x: 3});"
+        "load({y: 1, x: 4});");
+
+    Handle<JSFunction> load = GetJSFunction("load");
+    CHECK(!load->HasAttachedOptimizedCode(i_isolate()));
+    FeedbackNexus nexus(handle(load->feedback_vector(), i_isolate()),
+                        FeedbackSlot(0));
+    CHECK(IsLoadICKind(nexus.kind()));
+    CHECK_EQ(threshold == 0 ? InlineCacheState::POLYMORPHIC
+                            : InlineCacheState::MEGAMORPHIC,
+             nexus.ic_state());
+  }
+}
+
+TEST_F(DeoptimizationTest, DeoptStormMakesKeyedLoadMegamorphic) {
+  if (!i_isolate()->use_optimizer()) return;
+  FlagScope<bool> allow_natives_syntax(&v8_flags.allow_natives_syntax, true);
+  FlagScope<int> deopt_storm_threshold(&v8_flags.deopt_storm_threshold, 1);
+
+  // Element keys and name keys are recorded as such in the megamorphic
+  // feedback, which the IC and the optimizing compilers read back.
+  struct {
+    const char* warmup;
+    const char* deopt;
+    IcCheckType key_type;
+  } cases[] = {
+      {"load([1, 2], 0); load([3, 4], 1);", "load([1.5], 0);",
+       IcCheckType::kElement},
+      {"load({x: 1}, 'x'); load({x: 2}, 'x');", "load({y: 1, x: 3}, 'x');",
+       IcCheckType::kProperty},
+  };
+  for (const auto& c : cases) {
+    RunJS("var load = new Function('o', 'k', 'return o[k];');"
+          "%PrepareFunctionForOptimization(load);");
+    RunJS(c.warmup);
+    RunJS("%OptimizeFunctionOnNextCall(load);");
+    RunJS(c.warmup);
+    RunJS(c.deopt);
+
+    Handle<JSFunction> load = GetJSFunction("load");
+    CHECK(!load->HasAttachedOptimizedCode(i_isolate()));
+    FeedbackNexus nexus(handle(load->feedback_vector(), i_isolate()),
+                        FeedbackSlot(0));
+    CHECK(IsKeyedLoadICKind(nexus.kind()));
+    CHECK_EQ(InlineCacheState::MEGAMORPHIC, nexus.ic_state());
+    CHECK_EQ(c.key_type, nexus.GetKeyType());
+
+    // Run the megamorphic IC, then optimize again on top of the feedback.
+    RunJS(c.warmup);
+    RunJS(c.deopt);
+    CHECK_EQ(c.key_type, nexus.GetKeyType());
+    RunJS("%OptimizeFunctionOnNextCall(load);");
+    RunJS(c.warmup);
+    CHECK(load->HasAttachedOptimizedCode(i_isolate()));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
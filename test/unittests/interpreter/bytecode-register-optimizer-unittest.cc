@@ -6,6 +6,7 @@
 
 #include "src/interpreter/bytecode-label.h"
 #include "src/interpreter/bytecode-register-optimizer.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/interpreter/bytecode-utils.h"
 #include "test/unittests/test-utils.h"
 
@@ -218,6 +219,77 @@ TEST_F(BytecodeRegisterOptimizerTest, RangeOfTemporariesMaterializedForInput) {
   CHECK_EQ(output()->at(1).output.index(), temp1.index());
 }
 
+TEST_F(BytecodeRegisterOptimizerTest, AccumulatorReloadedAfterConditionalJump) {
+  FlagScope<bool> keep_accumulator(
+      &v8_flags.ignition_reo_across_conditional_jumps, false);
+  Initialize(3, 1);
+  Register local = Register(0);
+  optimizer()->DoStar(local);
+  CHECK_EQ(write_count(), 1u);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kJumpIfTrue,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  CHECK_EQ(write_count(), 1u);
+
+  optimizer()->DoLdar(local);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kReturn,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  CHECK_EQ(write_count(), 2u);
+  CHECK_EQ(output()->at(1).bytecode, Bytecode::kLdar);
+  CHECK_EQ(output()->at(1).input.index(), local.index());
+}
+
+TEST_F(BytecodeRegisterOptimizerTest, AccumulatorKeptAcrossConditionalJump) {
+  FlagScope<bool> keep_accumulator(
+      &v8_flags.ignition_reo_across_conditional_jumps, true);
+  Initialize(3, 1);
+  Register local = Register(0);
+  Register temp = NewTemporary();
+  optimizer()->DoStar(local);
+  optimizer()->DoStar(temp);
+  CHECK_EQ(write_count(), 1u);
+
+  // The jump target still sees every register materialized.
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kJumpIfTrue,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  CHECK_EQ(write_count(), 2u);
+  CHECK_EQ(output()->at(1).bytecode, Bytecode::kMov);
+  CHECK_EQ(output()->at(1).input.index(), local.index());
+  CHECK_EQ(output()->at(1).output.index(), temp.index());
+
+  // On the fall-through path neither register needs reloading.
+  optimizer()->DoLdar(local);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kJumpIfFalse,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  optimizer()->DoLdar(temp);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kReturn,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  CHECK_EQ(write_count(), 2u);
+}
+
+TEST_F(BytecodeRegisterOptimizerTest, AccumulatorNotKeptAcrossJump) {
+  FlagScope<bool> keep_accumulator(
+      &v8_flags.ignition_reo_across_conditional_jumps, true);
+  Initialize(3, 1);
+  Register local = Register(0);
+  optimizer()->DoStar(local);
+  CHECK_EQ(write_count(), 1u);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kJump, ImplicitRegisterUse::kNone>();
+  CHECK(optimizer()->EnsureAllRegistersAreFlushed());
+
+  optimizer()->DoLdar(local);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kReturn,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  CHECK_EQ(write_count(), 2u);
+  CHECK_EQ(output()->at(1).bytecode, Bytecode::kLdar);
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,61 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "src/flags/flags.h"
+#include "src/logging/counters.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+class JsonParserTest : public TestWithNativeContextAndCounters {
+ public:
+  int ParseAndCountTransitionLookups(int records) {
+    std::string json = "[";
+    for (int i = 0; i < records; i++) {
+      if (i > 0) json += ",";
+      json += "{\"id\":" + std::to_string(i) +
+              ",\"user\":{\"name\":\"u\",\"age\":" + std::to_string(i) + "}}";
+    }
+    json += "]";
+    std::string source = "JSON.parse('" + json + "')";
+
+    StatsCounter* counter =
+        isolate()->counters()->json_parse_transition_lookups();
+    CHECK(counter->Enabled());
+    int before = *counter->GetInternalPointer();
+    RunJS(source.c_str());
+    return *counter->GetInternalPointer() - before;
+  }
+};
+
+TEST_F(JsonParserTest, NestedRecordsSkipTransitionLookups) {
+  // Set up the transition tree, so that all parses below only look up
+  // existing transitions.
+  ParseAndCountTransitionLookups(2);
+
+  // Only the first record walks the transition tree, for both its own
+  // properties and those of its nested object. The other records and their
+  // nested objects take the expected map from the previous record.
+  int few = ParseAndCountTransitionLookups(2);
+  int many = ParseAndCountTransitionLookups(20);
+  EXPECT_GT(few, 0);
+  EXPECT_EQ(few, many);
+
+  // Without nested feedback, every nested object walks the tree again.
+  // Records themselves still take the previous record's map.
+  FlagScope<bool> no_nested_feedback(&v8_flags.json_parse_nested_feedback,
+                                     false);
+  int few_without_feedback = ParseAndCountTransitionLookups(2);
+  int many_without_feedback = ParseAndCountTransitionLookups(20);
+  EXPECT_GT(few_without_feedback, few);
+  EXPECT_GE(many_without_feedback - few_without_feedback, 2 * (20 - 2));
+}
+
+}  // namespace internal
+}  // namespace v8
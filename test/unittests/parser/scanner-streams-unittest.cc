@@ -354,6 +354,51 @@ TEST_F(ScannerStreamsTest, Utf8AdvanceUntilOverChunkBoundaries) {
   }
 }
 
+TEST_F(ScannerStreamsTest, AdvanceUntilWordwiseMatchesAdvanceUntil) {
+  // Place the line terminator at every offset in and around the first few
+  // words, with and without a non-ASCII code unit in front of it, and check
+  // that the word-at-a-time skip stops exactly where AdvanceUntil does.
+  auto is_line_terminator = [](v8::base::uc32 c0) {
+    return unibrow::IsLineTerminator(c0);
+  };
+  const uint16_t kTerminators[] = {'\n', '\r', 0x2028, 0x2029};
+  constexpr size_t kLen = 24;
+  for (uint16_t terminator : kTerminators) {
+    for (size_t stop = 0; stop <= kLen; stop++) {
+      for (size_t non_ascii = 0; non_ascii < kLen; non_ascii += 5) {
+        uint16_t data[kLen];
+        for (size_t i = 0; i < kLen; i++) data[i] = 'a';
+        data[non_ascii] = 0x00E9;
+        if (stop < kLen) data[stop] = terminator;
+
+        std::unique_ptr<i::Utf16CharacterStream> expected_stream(
+            i::ScannerStream::ForTesting(data, kLen));
+        std::unique_ptr<i::Utf16CharacterStream> stream(
+            i::ScannerStream::ForTesting(data, kLen));
+        v8::base::uc32 expected =
+            expected_stream->AdvanceUntil(is_line_terminator);
+        v8::base::uc32 actual =
+            stream->AdvanceUntilWordwise<'\n', '\r'>(is_line_terminator);
+        CHECK_EQ(expected, actual);
+        CHECK_EQ(expected_stream->pos(), stream->pos());
+      }
+    }
+  }
+}
+
+TEST_F(ScannerStreamsTest, AdvanceUntilWordwiseOverChunkBoundaries) {
+  const char16_t* chunks[] = {u"abc", u"defghi", u"jk", u"lmnopqrstu*vw", u""};
+  ChunkSource chunk_source(chunks);
+  std::unique_ptr<i::Utf16CharacterStream> stream(i::ScannerStream::For(
+      &chunk_source, v8::ScriptCompiler::StreamedSource::TWO_BYTE));
+  auto is_star = [](v8::base::uc32 c) { return c == '*'; };
+  v8::base::uc32 c0 = stream->AdvanceUntilWordwise<'*'>(is_star);
+  CHECK_EQ('*', c0);
+  CHECK_EQ('v', stream->Advance());
+  c0 = stream->AdvanceUntilWordwise<'*'>(is_star);
+  CHECK_EQ(i::Utf16CharacterStream::kEndOfInput, c0);
+}
+
 TEST_F(ScannerStreamsTest, Utf8ChunkBoundaries) {
   // Test utf-8 parsing at chunk boundaries.
 
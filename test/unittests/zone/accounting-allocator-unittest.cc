@@ -0,0 +1,82 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/zone/accounting-allocator.h"
+
+#include "src/zone/zone-segment.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+class AccountingAllocatorTest : public TestWithPlatform {};
+
+#ifndef V8_USE_ADDRESS_SANITIZER
+
+TEST_F(AccountingAllocatorTest, ReturnedSegmentsAreReused) {
+  FlagScope<size_t> pool_size(&v8_flags.zone_segment_pool_size, 1024);
+  AccountingAllocator allocator;
+
+  Segment* segment = allocator.AllocateSegment(8 * KB, false);
+  ASSERT_NE(nullptr, segment);
+  size_t size = segment->total_size();
+  EXPECT_EQ(size, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+
+  allocator.ReturnSegment(segment, false);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(size, allocator.GetPooledMemory());
+
+  // Pooled segments serve requests of their size class or smaller.
+  Segment* reused = allocator.AllocateSegment(4 * KB, false);
+  EXPECT_EQ(reinterpret_cast<Address>(segment),
+            reinterpret_cast<Address>(reused));
+  EXPECT_EQ(size, reused->total_size());
+  EXPECT_EQ(size, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+  allocator.ReturnSegment(reused, false);
+
+  // A larger request can't be served by the pooled segment.
+  Segment* larger = allocator.AllocateSegment(32 * KB, false);
+  EXPECT_LE(32 * KB, larger->total_size());
+  EXPECT_EQ(size, allocator.GetPooledMemory());
+  allocator.ReturnSegment(larger, false);
+
+  allocator.ReleasePooledSegments();
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+}
+
+TEST_F(AccountingAllocatorTest, PoolIsBounded) {
+  // The capacity is split across shards; a 96 KB pool allows at most 12 KB of
+  // pooled segments per thread.
+  FlagScope<size_t> pool_size(&v8_flags.zone_segment_pool_size, 96);
+  AccountingAllocator allocator;
+
+  Segment* first = allocator.AllocateSegment(8 * KB, false);
+  Segment* second = allocator.AllocateSegment(8 * KB, false);
+  allocator.ReturnSegment(first, false);
+  size_t pooled = allocator.GetPooledMemory();
+  EXPECT_LT(0u, pooled);
+  allocator.ReturnSegment(second, false);
+  EXPECT_EQ(pooled, allocator.GetPooledMemory());
+}
+
+#endif  // V8_USE_ADDRESS_SANITIZER
+
+TEST_F(AccountingAllocatorTest, PoolingCanBeDisabled) {
+  FlagScope<size_t> pool_size(&v8_flags.zone_segment_pool_size, 0);
+  AccountingAllocator allocator;
+
+  Segment* segment = allocator.AllocateSegment(8 * KB, false);
+  ASSERT_NE(nullptr, segment);
+  allocator.ReturnSegment(segment, false);
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+}
+
+}  // namespace internal
+}  // namespace v8